@@ -110,6 +110,7 @@ void arch_flush_local_fpu(void)
 
 		/* save current owner's content */
 		z_arm64_fpu_save(&owner->arch.saved_fp_context);
+		z_float_context_saved(owner);
 		/* make sure content made it to memory before releasing */
 		barrier_dsync_fence_full();
 		/* release ownership */
@@ -273,6 +274,7 @@ void z_arm64_fpu_trap(struct arch_esf *esf)
 
 	if (owner) {
 		z_arm64_fpu_save(&owner->arch.saved_fp_context);
+		z_float_context_saved(owner);
 		barrier_dsync_fence_full();
 		atomic_ptr_clear(&_current_cpu->arch.fpu_owner);
 		DBG("save", owner);
@@ -302,6 +304,7 @@ void z_arm64_fpu_trap(struct arch_esf *esf)
 
 	/* restore our content */
 	z_arm64_fpu_restore(&_current->arch.saved_fp_context);
+	z_float_context_restored(_current);
 	DBG("restore", NULL);
 }
 
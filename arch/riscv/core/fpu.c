@@ -87,6 +87,7 @@ static void z_riscv_fpu_load(void)
 	/* restore our content */
 	csr_set(mstatus, MSTATUS_FS_INIT);
 	z_riscv_fpu_restore(&_current->arch.saved_fp_context);
+	z_float_context_restored(_current);
 	DBG("restore", _current);
 }
 
@@ -115,6 +116,7 @@ void arch_flush_local_fpu(void)
 			csr_set(mstatus, MSTATUS_FS_CLEAN);
 			/* save current owner's content */
 			z_riscv_fpu_save(&owner->arch.saved_fp_context);
+			z_float_context_saved(owner);
 		}
 
 		/* dirty means active use */
@@ -262,7 +264,8 @@ static bool fpu_access_allowed(unsigned int exc_update_level)
 			/* everything is already in place */
 			return true;
 		}
-		if (_current->arch.fpu_recently_used) {
+		if (!IS_ENABLED(CONFIG_RISCV_FPU_STRICTLY_LAZY) &&
+		    _current->arch.fpu_recently_used) {
 			/*
 			 * Before this thread was context-switched out,
 			 * it made active use of the FPU, but someone else
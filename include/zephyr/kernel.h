@@ -1617,6 +1617,13 @@ const char *k_thread_state_str(k_tid_t thread_id, char *buf, size_t buf_size);
  * @cond INTERNAL_HIDDEN
  */
 
+struct k_timer_stats {
+	/* Number of expirations */
+	uint32_t expirations;
+	/* Expirations deferred by the slack to share a wakeup */
+	uint32_t merged;
+};
+
 struct k_timer {
 	/*
 	 * _timeout structure must be first here if we want to use
@@ -1648,6 +1655,9 @@ struct k_timer {
 #ifdef CONFIG_OBJ_CORE_TIMER
 	struct k_obj_core  obj_core;
 #endif
+#ifdef CONFIG_OBJ_CORE_STATS_TIMER
+	struct k_timer_stats stats;
+#endif
 };
 
 #define Z_TIMER_INITIALIZER(obj, expiry, stop) \
@@ -3152,6 +3162,19 @@ extern struct k_work_q k_sys_work_q;
  * @{
  */
 
+/**
+ * @brief Adaptive spinning statistics of a mutex or semaphore
+ *
+ * Reported by the object core statistics of mutexes and semaphores when
+ * CONFIG_ADAPTIVE_SPIN is enabled.
+ */
+struct k_adaptive_spin_stats {
+	/** Number of times a thread spun on the object before blocking */
+	uint32_t spins;
+	/** Number of those times the object was acquired while spinning */
+	uint32_t acquired;
+};
+
 /**
  * Mutex Structure
  * @ingroup mutex_apis
@@ -3173,6 +3196,9 @@ struct k_mutex {
 #ifdef CONFIG_OBJ_CORE_MUTEX
 	struct k_obj_core obj_core;
 #endif
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	struct k_adaptive_spin_stats stats;
+#endif
 };
 
 /**
@@ -3349,6 +3375,166 @@ __syscall int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
  * @}
  */
 
+/**
+ * @defgroup rwlock_apis Reader-Writer Lock APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Contention statistics of a reader-writer lock
+ *
+ * Reported by the object core statistics of reader-writer locks.
+ */
+struct k_rwlock_stats {
+	/** Number of times a reader had to wait for the lock */
+	uint32_t read_waits;
+	/** Number of times a writer had to wait for the lock */
+	uint32_t write_waits;
+};
+
+/**
+ * Reader-writer lock structure
+ * @ingroup rwlock_apis
+ */
+struct k_rwlock {
+	/** Readers waiting for the lock */
+	_wait_q_t read_wait_q;
+	/** Writers waiting for the lock */
+	_wait_q_t write_wait_q;
+	/** Writer thread or number of readers, and lock flags */
+	atomic_t state;
+	/** Original priority of the writer */
+	int writer_orig_prio;
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+	struct k_obj_core obj_core;
+#endif
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	struct k_rwlock_stats stats;
+#endif
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_RWLOCK_INITIALIZER(obj) \
+	{ \
+	.read_wait_q = Z_WAIT_Q_INIT(&(obj).read_wait_q), \
+	.write_wait_q = Z_WAIT_Q_INIT(&(obj).write_wait_q), \
+	.state = ATOMIC_INIT(0), \
+	.writer_orig_prio = K_LOWEST_APPLICATION_THREAD_PRIO, \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Statically define and initialize a reader-writer lock.
+ *
+ * The lock can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct k_rwlock <name>; @endcode
+ *
+ * @param name Name of the reader-writer lock.
+ */
+#define K_RWLOCK_DEFINE(name) \
+	STRUCT_SECTION_ITERABLE(k_rwlock, name) = \
+		Z_RWLOCK_INITIALIZER(name)
+
+/**
+ * @brief Initialize a reader-writer lock.
+ *
+ * This routine initializes a reader-writer lock object, prior to its first
+ * use. Upon completion, the lock is neither held for reading nor for
+ * writing.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Reader-writer lock object created
+ */
+__syscall int k_rwlock_init(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader-writer lock for reading.
+ *
+ * Any number of threads may hold the lock for reading at the same time.
+ * If the lock is held for writing, or if a writer is waiting for it, the
+ * calling thread waits until all writers are done or until a timeout
+ * occurs. Writers are thus preferred over readers.
+ *
+ * While waiting, the calling thread lends its priority to the writer
+ * holding the lock, if any.
+ *
+ * A thread holding the lock for reading must not lock it again if a
+ * writer may be waiting for it, as it would deadlock.
+ *
+ * Reader-writer locks may not be used in ISRs.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to lock the reader-writer lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Lock held for reading.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a reader-writer lock held for reading.
+ *
+ * When the last reader unlocks the lock, the highest priority writer
+ * waiting for it, if any, acquires it.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Reader-writer lock unlocked.
+ * @retval -EINVAL The lock is not held for reading.
+ */
+__syscall int k_rwlock_read_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader-writer lock for writing.
+ *
+ * Only one thread may hold the lock for writing, and only when no thread
+ * holds it for reading. Otherwise the calling thread waits until the lock
+ * is released or until a timeout occurs.
+ *
+ * The thread holding the lock for writing inherits the priority of the
+ * threads waiting for it, as with mutexes. Threads holding the lock for
+ * reading do not.
+ *
+ * The lock is not recursive for writers.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to lock the reader-writer lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Lock held for writing.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a reader-writer lock held for writing.
+ *
+ * The lock is passed on to the highest priority writer waiting for it, if
+ * any. Otherwise, all the readers waiting for it acquire it.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Reader-writer lock unlocked.
+ * @retval -EPERM The current thread does not hold the lock for writing.
+ */
+__syscall int k_rwlock_write_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @}
+ */
+
 /**
  * @defgroup semaphore_apis Semaphore APIs
  * @ingroup kernel_apis
@@ -3375,6 +3561,9 @@ struct k_sem {
 
 #ifdef CONFIG_OBJ_CORE_SEM
 	struct k_obj_core  obj_core;
+#endif
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	struct k_adaptive_spin_stats stats;
 #endif
 	/** @endcond */
 };
@@ -3602,6 +3791,7 @@ void k_ipi_work_signal(void);
 
 struct k_work_delayable;
 struct k_work_sync;
+struct k_work_q_worker;
 
 /**
  * INTERNAL_HIDDEN @endcond
@@ -3827,6 +4017,47 @@ void k_work_queue_start(struct k_work_q *queue,
  */
 void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *cfg);
 
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+/** @brief Initialize a work queue animated by a pool of threads.
+ *
+ * This works like k_work_queue_start(), except that the queue is run by
+ * @p num_workers threads.  A work item is run by whichever worker takes it
+ * first, and a worker that runs out of work steals the items chained from
+ * the handlers of busy workers.  All guarantees of a single thread queue are
+ * kept: a work item is never run by two workers at the same time, and
+ * flushing, cancellation, draining and stopping wait for all the workers.
+ * Items are however not guaranteed to complete in submission order.
+ *
+ * The pool does not support @ref k_work_queue_config.work_timeout_ms, and
+ * k_work_queue_thread_get() returns the first worker.
+ *
+ * @kconfig_dep{CONFIG_WORKQUEUE_POOL}
+ *
+ * @param queue pointer to the queue structure. It must be initialized
+ *        in zeroed/bss memory or with @ref k_work_queue_init before
+ *        use.
+ *
+ * @param workers array of @p num_workers worker structures.
+ *
+ * @param num_workers number of worker threads, at least one.
+ *
+ * @param stacks first element of an array of @p num_workers stacks of
+ * @p stack_size bytes, defined with K_THREAD_STACK_ARRAY_DEFINE().
+ *
+ * @param stack_size size of each worker stack, in bytes.
+ *
+ * @param prio initial priority of the worker threads
+ *
+ * @param cfg optional additional configuration parameters.  Pass @c
+ * NULL if not required, to use the defaults documented in
+ * k_work_queue_config.
+ */
+void k_work_queue_start_pool(struct k_work_q *queue,
+			     struct k_work_q_worker *workers, size_t num_workers,
+			     k_thread_stack_t *stacks, size_t stack_size,
+			     int prio, const struct k_work_queue_config *cfg);
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /** @brief Access the thread that animates a work queue.
  *
  * This is necessary to grant a work queue thread access to things the work
@@ -4409,8 +4640,40 @@ struct k_work_queue_config {
 	 * an error will be logged if CONFIG_LOG is enabled.
 	 */
 	uint32_t work_timeout_ms;
+
+	/** Control whether the threads of a work queue pool are pinned to
+	 * CPUs.
+	 *
+	 * If @c true, and CONFIG_SCHED_CPU_MASK is enabled, the workers
+	 * started by k_work_queue_start_pool() are pinned to the CPUs in
+	 * turn, so that the pool spreads over the whole system.
+	 */
+	bool pin_workers;
 };
 
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+/** @brief A thread of a work queue pool.
+ *
+ * The fields are private, and must be accessed only while the work module
+ * spinlock is held.
+ */
+struct k_work_q_worker {
+	/* The thread of the worker. */
+	struct k_thread thread;
+
+	/* The queue the worker belongs to. */
+	struct k_work_q *queue;
+
+	/* Work items chained by the worker, or bound to it because they
+	 * are running on it.
+	 */
+	sys_slist_t pending;
+
+	/* The work item being run, or NULL when idle. */
+	struct k_work *work;
+};
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /** @brief A structure used to hold work until it can be processed. */
 struct k_work_q {
 	/* The thread that animates the work. */
@@ -4442,6 +4705,20 @@ struct k_work_q {
 	struct k_work *work;
 	k_timeout_t work_timeout;
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
+
+#if defined(CONFIG_WORKQUEUE_POOL)
+	/* Threads animating a pool, or NULL for a single thread queue. */
+	struct k_work_q_worker *workers;
+
+	/* Number of threads in the pool. */
+	uint16_t num_workers;
+
+	/* Number of threads of the pool running a work item. */
+	uint16_t num_busy;
+
+	/* Number of threads of the pool that have not exited. */
+	uint16_t num_alive;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4837,6 +5114,21 @@ struct k_msgq {
 	/** Number of used messages */
 	uint32_t used_msgs;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	/** Per-slot sequence numbers of the lock-free ring, or NULL */
+	atomic_t *slot_seq;
+	/** Ring position of the next message to write */
+	atomic_t write_pos;
+	/** Ring position of the next message to read */
+	atomic_t read_pos;
+	/** Number of ring laps before positions wrap around */
+	uint32_t laps;
+	/** Number of threads pending, or about to pend, on the queue */
+	atomic_t waiters;
+	/** Threads waiting for space in the lock-free ring */
+	_wait_q_t send_wait_q;
+#endif
+
 	Z_DECL_POLL_EVENT
 
 	/** Message queue */
@@ -4853,7 +5145,26 @@ struct k_msgq {
  */
 
 
-#define Z_MSGQ_INITIALIZER(obj, q_buffer, q_msg_size, q_max_msgs) \
+#ifdef CONFIG_MSGQ_LOCKFREE
+/* Ring positions wrap around after at most Z_MSGQ_LOCKFREE_POS_MAX messages */
+#define Z_MSGQ_LOCKFREE_POS_MAX BIT(29)
+
+/* Larger queues have too few laps to tell them apart and stay locked */
+#define Z_MSGQ_LOCKFREE_FITS(q_max_msgs) \
+	(((q_max_msgs) != 0U) && ((q_max_msgs) <= (Z_MSGQ_LOCKFREE_POS_MAX / 4U)))
+
+#define Z_MSGQ_LOCKFREE_INIT(obj, q_slot_seq, q_max_msgs) \
+	.slot_seq = q_slot_seq, \
+	.write_pos = ATOMIC_INIT(0), \
+	.read_pos = ATOMIC_INIT(0), \
+	.laps = Z_MSGQ_LOCKFREE_POS_MAX / MAX((q_max_msgs), 1U), \
+	.waiters = ATOMIC_INIT(0), \
+	.send_wait_q = Z_WAIT_Q_INIT(&obj.send_wait_q),
+#else
+#define Z_MSGQ_LOCKFREE_INIT(obj, q_slot_seq, q_max_msgs)
+#endif
+
+#define Z_MSGQ_INITIALIZER_SEQ(obj, q_buffer, q_msg_size, q_max_msgs, q_slot_seq) \
 	{ \
 	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
 	.lock = {}, \
@@ -4864,10 +5175,27 @@ struct k_msgq {
 	.read_ptr = q_buffer, \
 	.write_ptr = q_buffer, \
 	.used_msgs = 0, \
+	Z_MSGQ_LOCKFREE_INIT(obj, q_slot_seq, q_max_msgs) \
 	Z_POLL_EVENT_OBJ_INIT(obj) \
 	.flags = 0, \
 	}
 
+#define Z_MSGQ_INITIALIZER(obj, q_buffer, q_msg_size, q_max_msgs) \
+	Z_MSGQ_INITIALIZER_SEQ(obj, q_buffer, q_msg_size, q_max_msgs, NULL)
+
+#ifdef CONFIG_MSGQ_LOCKFREE
+#define Z_MSGQ_SLOT_SEQ_DEFINE(q_name, q_max_msgs) \
+	static atomic_t _k_msgq_seq_##q_name[ \
+		Z_MSGQ_LOCKFREE_FITS(q_max_msgs) ? (q_max_msgs) : 1U];
+#define Z_MSGQ_SLOT_SEQ(q_name, q_max_msgs) \
+	(Z_MSGQ_LOCKFREE_FITS(q_max_msgs) ? _k_msgq_seq_##q_name : NULL)
+
+uint32_t z_msgq_lockfree_used(struct k_msgq *msgq);
+#else
+#define Z_MSGQ_SLOT_SEQ_DEFINE(q_name, q_max_msgs)
+#define Z_MSGQ_SLOT_SEQ(q_name, q_max_msgs) NULL
+#endif
+
 /**
  * INTERNAL_HIDDEN @endcond
  */
@@ -4913,6 +5241,33 @@ struct k_msgq_attrs {
 	       Z_MSGQ_INITIALIZER(q_name, _k_fifo_buf_##q_name,	\
 				  (q_msg_size), (q_max_msgs))
 
+/**
+ * @brief Statically define and initialize a lock-free message queue.
+ *
+ * Same as K_MSGQ_DEFINE(), except that with @kconfig{CONFIG_MSGQ_LOCKFREE}
+ * the messages are kept in a lock-free ring, which needs one more atomic_t
+ * per message. Senders and receivers then only take the message queue lock
+ * when they have to wait or to wake up a waiting thread.
+ * k_msgq_put_front() is not supported on such a queue and returns -ENOTSUP.
+ *
+ * Without @kconfig{CONFIG_MSGQ_LOCKFREE}, or with no room for messages or
+ * more than 2^27 of them, the message queue is the same as one defined with
+ * K_MSGQ_DEFINE().
+ *
+ * @param q_name Name of the message queue.
+ * @param q_msg_size Message size (in bytes).
+ * @param q_max_msgs Maximum number of messages that can be queued.
+ * @param q_align Alignment of the message queue's ring buffer (power of 2).
+ */
+#define K_MSGQ_LOCKFREE_DEFINE(q_name, q_msg_size, q_max_msgs, q_align)	\
+	static char __noinit __aligned(q_align)				\
+		_k_fifo_buf_##q_name[(q_max_msgs) * (q_msg_size)];	\
+	Z_MSGQ_SLOT_SEQ_DEFINE(q_name, q_max_msgs)			\
+	STRUCT_SECTION_ITERABLE(k_msgq, q_name) =			\
+	       Z_MSGQ_INITIALIZER_SEQ(q_name, _k_fifo_buf_##q_name,	\
+				      (q_msg_size), (q_max_msgs),	\
+				      Z_MSGQ_SLOT_SEQ(q_name, q_max_msgs))
+
 /**
  * @brief Initialize a message queue.
  *
@@ -5002,6 +5357,10 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  *
  * @note k_msgq_put_front() does not block.
  *
+ * @note Queues defined with K_MSGQ_LOCKFREE_DEFINE() may keep their messages
+ * in a ring that can only be written at its back, and this function fails
+ * on them with -ENOTSUP.
+ *
  * @funcprops \isr_ok
  *
  * @param msgq Address of the message queue.
@@ -5009,6 +5368,7 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  *
  * @retval 0 Message sent.
  * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -ENOTSUP Queue defined with K_MSGQ_LOCKFREE_DEFINE() is a ring.
  */
 __syscall int k_msgq_put_front(struct k_msgq *msgq, const void *data);
 
@@ -5105,6 +5465,11 @@ __syscall void  k_msgq_get_attrs(struct k_msgq *msgq,
 
 static inline uint32_t z_impl_k_msgq_num_free_get(struct k_msgq *msgq)
 {
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq->slot_seq != NULL) {
+		return msgq->max_msgs - z_msgq_lockfree_used(msgq);
+	}
+#endif
 	return msgq->max_msgs - msgq->used_msgs;
 }
 
@@ -5121,6 +5486,11 @@ __syscall uint32_t k_msgq_num_used_get(struct k_msgq *msgq);
 
 static inline uint32_t z_impl_k_msgq_num_used_get(struct k_msgq *msgq)
 {
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq->slot_seq != NULL) {
+		return z_msgq_lockfree_used(msgq);
+	}
+#endif
 	return msgq->used_msgs;
 }
 
@@ -5302,6 +5672,8 @@ __syscall void k_pipe_init(struct k_pipe *pipe, uint8_t *buffer, size_t buffer_s
 enum pipe_flags {
 	PIPE_FLAG_OPEN = BIT(0),
 	PIPE_FLAG_RESET = BIT(1),
+	PIPE_FLAG_WRITE_CLAIMED = BIT(2),
+	PIPE_FLAG_READ_CLAIMED = BIT(3),
 };
 
 struct k_pipe {
@@ -5392,6 +5764,103 @@ __syscall int k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len,
 __syscall int k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len,
 			  k_timeout_t timeout);
 
+/**
+ * @brief Claim space in a pipe for writing in place
+ *
+ * This routine hands out a contiguous area of up to @a len bytes of the pipe's
+ * ring buffer, so that data can be produced directly into it instead of being
+ * copied by k_pipe_write(..). The claimed area may be smaller than requested
+ * if the free space is smaller or wraps around the end of the buffer. If the
+ * pipe is full, the routine will block until space is available or the timeout
+ * expires.
+ *
+ * Only one write claim can be outstanding on a pipe at a time. Until it is
+ * committed with k_pipe_write_commit(..), other writers block as if the pipe
+ * was full.
+ *
+ * @note This routine is not available to user mode threads.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of a pointer set to the claimed area.
+ * @param len Requested number of bytes.
+ * @param timeout Waiting period to wait for space to be available.
+ *
+ * @retval number of bytes claimed on success
+ * @retval -EAGAIN if no space could be claimed before the timeout expired
+ * @retval -ECANCELED if the claim was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed
+ * @retval -EINVAL if @a len is zero
+ * @retval -ENOTSUP if the pipe has no ring buffer
+ */
+int k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len, k_timeout_t timeout);
+
+/**
+ * @brief Commit data written in place to a pipe
+ *
+ * This routine makes the first @a len bytes of the area claimed with
+ * k_pipe_write_claim(..) available to readers and ends the write claim.
+ * The rest of the claimed area is returned to the pipe's free space.
+ *
+ * @note This routine is not available to user mode threads.
+ *
+ * @param pipe Address of the pipe.
+ * @param len Number of bytes written to the claimed area, possibly zero.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if no write claim is outstanding, or @a len exceeds the
+ *         claimed area
+ * @retval -EPIPE if the pipe was closed, the data is discarded
+ */
+int k_pipe_write_commit(struct k_pipe *pipe, size_t len);
+
+/**
+ * @brief Claim data in a pipe for reading in place
+ *
+ * This routine hands out a contiguous area of up to @a len bytes of data from
+ * the pipe's ring buffer, so that it can be consumed directly instead of being
+ * copied by k_pipe_read(..). The claimed area may be smaller than requested if
+ * less data is available or the data wraps around the end of the buffer. If
+ * the pipe is empty, the routine will block until data is available or the
+ * timeout expires.
+ *
+ * Only one read claim can be outstanding on a pipe at a time. Until it is
+ * released with k_pipe_read_release(..), other readers block as if the pipe
+ * was empty.
+ *
+ * @note This routine is not available to user mode threads.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of a pointer set to the claimed area.
+ * @param len Requested number of bytes.
+ * @param timeout Waiting period to wait for data to be available.
+ *
+ * @retval number of bytes claimed on success
+ * @retval -EAGAIN if no data could be claimed before the timeout expired
+ * @retval -ECANCELED if the claim was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed and is empty
+ * @retval -EINVAL if @a len is zero
+ * @retval -ENOTSUP if the pipe has no ring buffer
+ */
+int k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len, k_timeout_t timeout);
+
+/**
+ * @brief Release data read in place from a pipe
+ *
+ * This routine frees the first @a len bytes of the area claimed with
+ * k_pipe_read_claim(..) and ends the read claim. The rest of the claimed data
+ * is left in the pipe, to be read again.
+ *
+ * @note This routine is not available to user mode threads.
+ *
+ * @param pipe Address of the pipe.
+ * @param len Number of bytes consumed from the claimed area, possibly zero.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if no read claim is outstanding, or @a len exceeds the
+ *         claimed area
+ */
+int k_pipe_read_release(struct k_pipe *pipe, size_t len);
+
 /**
  * @brief Reset a pipe
  * This routine resets the pipe, discarding any unread data and unblocking any threads waiting to
@@ -5426,12 +5895,32 @@ struct k_mem_slab_info {
 #endif
 };
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+/* Per-CPU cache ("magazine") of free blocks, linked like the free list */
+struct z_mem_slab_cpu_cache {
+	struct k_spinlock lock;
+	char *free_list;
+	uint32_t num_free;
+};
+#endif
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
 	char *buffer;
 	char *free_list;
 	struct k_mem_slab_info info;
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	/* Blocks in the caches are accounted as used in info.num_used */
+	struct z_mem_slab_cpu_cache cpu_cache[CONFIG_MP_MAX_NUM_CPUS];
+	/* Threads allocating with a timeout: blocks bypass the caches */
+	atomic_t num_waiters;
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	/* Blocks handed out to users, tracked without taking the lock */
+	atomic_t num_in_use;
+	atomic_t max_in_use;
+#endif
+#endif
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 
@@ -5628,6 +6117,56 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem,
  */
 void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
 
+/**
+ * @brief Allocate several memory blocks from a memory slab.
+ *
+ * This routine allocates up to @a count memory blocks from @a slab while
+ * taking the slab's lock only once, which is cheaper than calling
+ * k_mem_slab_alloc() @a count times. Fewer blocks than requested are
+ * returned when the slab runs short of free blocks. If no block is free
+ * at all, the routine waits for one as k_mem_slab_alloc() does.
+ *
+ * @note When @a timeout is not K_NO_WAIT, this routine must not be called
+ * from an ISR.
+ *
+ * @param slab Address of the memory slab.
+ * @param mem Array receiving the starting addresses of the memory blocks.
+ * @param count Maximum number of memory blocks to allocate.
+ * @param timeout Waiting period to wait for at least one memory block.
+ *        Use K_NO_WAIT to return without waiting,
+ *        or K_FOREVER to wait as long as necessary.
+ *
+ * @return Number of memory blocks allocated, stored at the start of @a mem.
+ * @retval -ENOMEM Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL Invalid data supplied
+ */
+int k_mem_slab_alloc_bulk(struct k_mem_slab *slab, void **mem, uint32_t count,
+			  k_timeout_t timeout);
+
+/**
+ * @brief Free several memory blocks allocated from a memory slab.
+ *
+ * This routine releases @a count previously allocated memory blocks back
+ * to @a slab while taking the slab's lock only once. Threads waiting for
+ * a block are served first.
+ *
+ * @param slab Address of the memory slab.
+ * @param mem Array of pointers to the memory blocks.
+ * @param count Number of memory blocks to free.
+ */
+void k_mem_slab_free_bulk(struct k_mem_slab *slab, void **mem, uint32_t count);
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+uint32_t z_mem_slab_num_used_get(struct k_mem_slab *slab);
+#endif
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
 /**
  * @brief Get the number of used blocks in a memory slab.
  *
@@ -5640,7 +6179,11 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	return z_mem_slab_num_used_get(slab);
+#else
 	return slab->info.num_used;
+#endif
 }
 
 /**
@@ -5655,7 +6198,9 @@ static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
 {
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+#if defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION) && defined(CONFIG_MEM_SLAB_CPU_CACHE)
+	return (uint32_t)atomic_get(&slab->max_in_use);
+#elif defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION)
 	return slab->info.max_used;
 #else
 	ARG_UNUSED(slab);
@@ -5675,7 +6220,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -5846,10 +6391,34 @@ void *k_heap_realloc(struct k_heap *h, void *ptr, size_t bytes, k_timeout_t time
  */
 void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+/* Upper bound of the room taken by the per-CPU caches in the heap
+ * metadata, checked in lib/heap/heap_cache.c
+ */
+#define Z_HEAP_CACHE_SIZE (2 * sizeof(size_t) + CONFIG_MP_MAX_NUM_CPUS *		\
+			   (sizeof(struct k_spinlock) + 2 * sizeof(size_t) +		\
+			    5 * CONFIG_SYS_HEAP_CACHE_CLASSES))
+#else
+#define Z_HEAP_CACHE_SIZE 0
+#endif
+
+#ifdef CONFIG_SYS_HEAP_TLSF
+/* Hand-calculated growth of the buckets of a minimum heap with the
+ * free lists of CONFIG_SYS_HEAP_TLSF
+ */
+#define Z_HEAP_TLSF_SIZE								\
+	((CONFIG_SYS_HEAP_TLSF_SL_BITS == 1) ? 32 :					\
+	 (CONFIG_SYS_HEAP_TLSF_SL_BITS == 2) ? 64 :					\
+	 (CONFIG_SYS_HEAP_TLSF_SL_BITS == 3) ? 168 :					\
+	 (CONFIG_SYS_HEAP_TLSF_SL_BITS == 4) ? 392 : 912)
+#else
+#define Z_HEAP_TLSF_SIZE 0
+#endif
+
 /* Hand-calculated minimum heap sizes needed to return a successful
  * 1-byte allocation.  See details in lib/os/heap.[ch]
  */
-#define Z_HEAP_MIN_SIZE ((sizeof(void *) > 4) ? 56 : 44)
+#define Z_HEAP_MIN_SIZE (((sizeof(void *) > 4) ? 56 : 44) + Z_HEAP_CACHE_SIZE + Z_HEAP_TLSF_SIZE)
 
 /**
  * @brief Define a static k_heap in the specified linker section
@@ -6330,6 +6899,92 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+/**
+ * @brief Persistent poll set
+ *
+ * A poll set keeps its events registered on their objects across waits and
+ * tracks the ones that became ready, so that waiting on it costs in
+ * proportion to the number of ready events rather than to the number of
+ * events in the set.
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t ready;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t reported;
+
+	/** PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+};
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * @param set Address of the poll set.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add an event to a poll set.
+ *
+ * The event, initialized with k_poll_event_init(), stays registered on its
+ * object until it is removed from the set. It must not be passed to
+ * k_poll() or k_work_poll_submit() while it belongs to the set.
+ *
+ * @param set Address of the poll set.
+ * @param event Address of the event to add.
+ *
+ * @retval 0 Event added.
+ * @retval -EBUSY Event already registered with a poller.
+ */
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove an event from a poll set.
+ *
+ * @param set Address of the poll set.
+ * @param event Address of the event to remove.
+ *
+ * @retval 0 Event removed.
+ * @retval -EINVAL Event does not belong to the set.
+ */
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to be ready.
+ *
+ * This routine returns the events of the set that became ready, up to
+ * @a max_events of them, in the order they became ready. Their state field
+ * tells which condition was met, as with k_poll().
+ *
+ * Events are level-triggered: the events returned by one wait are checked
+ * again at the start of the next one, and are returned again if their
+ * object is still available. The caller is thus expected to consume the
+ * objects of the returned events before waiting again.
+ *
+ * Several threads may wait on the same set, each ready event is then
+ * returned to only one of them.
+ *
+ * @funcprops \isr_ok (with K_NO_WAIT timeout)
+ *
+ * @param set Address of the poll set.
+ * @param ready Array receiving the addresses of the ready events.
+ * @param max_events Size of the @a ready array.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of ready events written to @a ready, which is at least
+ *         one.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL @a max_events is not positive.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int max_events, k_timeout_t timeout);
+
 /** @} */
 
 /**
@@ -6528,6 +7183,26 @@ __syscall int k_float_disable(struct k_thread *thread);
  */
 __syscall int k_float_enable(struct k_thread *thread, unsigned int options);
 
+/**
+ * @brief Get the floating point context switch statistics of a thread
+ *
+ * This routine retrieves how many times the floating point context of
+ * @a thread was saved to and restored from memory since it was created.
+ *
+ * Architectures switching the floating point context lazily only save and
+ * restore it when some thread actually uses the floating point registers,
+ * so the counts tell apart the context switches which did cost a floating
+ * point context switch from the ones which did not.
+ *
+ * @param thread ID of thread.
+ * @param stats  Pointer to struct to copy the statistics into.
+ *
+ * @retval 0        On success.
+ * @retval -ENOTSUP If @kconfig{CONFIG_FPU_SHARING_STATS} is not enabled.
+ */
+__syscall int k_float_stats_get(struct k_thread *thread,
+				struct k_float_stats *stats);
+
 /**
  * @}
  */
@@ -50,6 +50,12 @@ struct k_mem_paging_stats_t {
 		/** Number of page faults while in ISR */
 		unsigned long			in_isr;
 #endif /* !CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+
+		/** Total time spent handling page faults, in cycles */
+		unsigned long			cycles;
+
+		/** Longest time spent handling a page fault, in cycles */
+		unsigned long			longest_cycles;
 	} pagefaults;
 
 	struct {
@@ -58,7 +64,18 @@ struct k_mem_paging_stats_t {
 
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
+
+		/** Number of pages evicted by background eviction */
+		unsigned long			background;
 	} eviction;
+
+	struct {
+		/** Number of page faults following the previous one */
+		unsigned long			sequential;
+
+		/** Number of pages read ahead of page faults */
+		unsigned long			pages;
+	} read_ahead;
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
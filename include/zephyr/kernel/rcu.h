@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Read-copy-update (RCU) synchronization
+ */
+
+#ifndef ZEPHYR_INCLUDE_KERNEL_RCU_H_
+#define ZEPHYR_INCLUDE_KERNEL_RCU_H_
+
+#include <stdbool.h>
+#include <zephyr/sys/slist.h>
+#include <zephyr/sys/barrier.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup rcu_apis RCU APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+struct k_rcu_head;
+
+/**
+ * @brief RCU callback
+ *
+ * @param head RCU head passed to k_rcu_call()
+ */
+typedef void (*k_rcu_callback_t)(struct k_rcu_head *head);
+
+/**
+ * @brief RCU callback head
+ *
+ * Embedded in the object to be reclaimed with k_rcu_call().
+ */
+struct k_rcu_head {
+	/** @cond INTERNAL_HIDDEN */
+	sys_snode_t node;
+	k_rcu_callback_t func;
+	/** @endcond */
+};
+
+/**
+ * @brief Enter an RCU read-side critical section.
+ *
+ * Data published with K_RCU_ASSIGN_POINTER() and read with
+ * K_RCU_DEREFERENCE() inside the critical section is not reclaimed before
+ * k_rcu_read_unlock() is called.  This neither takes a lock nor prevents
+ * preemption, and read-side critical sections may be nested.
+ *
+ * A thread may block inside a read-side critical section, but it then
+ * delays every updater waiting for a grace period.
+ *
+ * @funcprops \isr_ok
+ */
+void k_rcu_read_lock(void);
+
+/**
+ * @brief Leave an RCU read-side critical section.
+ *
+ * @funcprops \isr_ok
+ */
+void k_rcu_read_unlock(void);
+
+/**
+ * @brief Wait for an RCU grace period.
+ *
+ * Returns once every read-side critical section that was in progress
+ * when it was called has ended, so that data removed from the view of
+ * the readers before the call can be reclaimed.  The wait usually lasts
+ * a few ticks.
+ *
+ * This must not be called from an ISR, nor inside a read-side critical
+ * section.
+ */
+void k_rcu_synchronize(void);
+
+/**
+ * @brief Reclaim data after an RCU grace period.
+ *
+ * Calls @a func from the system work queue once every read-side critical
+ * section that was in progress when k_rcu_call() was called has ended.
+ * Unlike k_rcu_synchronize(), this never blocks the caller.
+ *
+ * @param head RCU head embedded in the data to reclaim
+ * @param func Function called with @a head after the grace period
+ *
+ * @funcprops \isr_ok
+ */
+void k_rcu_call(struct k_rcu_head *head, k_rcu_callback_t func);
+
+/**
+ * @brief Read a pointer published by an RCU updater.
+ *
+ * @param ptr Pointer read once, inside a read-side critical section
+ */
+#define K_RCU_DEREFERENCE(ptr) (*(volatile __typeof__(ptr) *)&(ptr))
+
+/**
+ * @brief Publish a pointer to RCU readers.
+ *
+ * Makes sure that the readers see the data @a val points to initialized
+ * before they see @a val.
+ *
+ * @param ptr Pointer read by the readers with K_RCU_DEREFERENCE()
+ * @param val New value of @a ptr
+ */
+#define K_RCU_ASSIGN_POINTER(ptr, val)                                         \
+	do {                                                                   \
+		barrier_dmem_fence_full();                                     \
+		*(volatile __typeof__(ptr) *)&(ptr) = (val);                   \
+	} while (false)
+
+/**
+ * @brief Prepend a node to a list read by RCU readers.
+ *
+ * Updaters of the list must still exclude each other.
+ *
+ * @param list A pointer on the list to affect
+ * @param node A pointer on the initialized node to prepend
+ */
+static inline void k_rcu_slist_prepend(sys_slist_t *list, sys_snode_t *node)
+{
+	node->next = list->head;
+	if (list->tail == NULL) {
+		list->tail = node;
+	}
+
+	K_RCU_ASSIGN_POINTER(list->head, node);
+}
+
+/**
+ * @brief Append a node to a list read by RCU readers.
+ *
+ * Updaters of the list must still exclude each other.
+ *
+ * @param list A pointer on the list to affect
+ * @param node A pointer on the node to append
+ */
+static inline void k_rcu_slist_append(sys_slist_t *list, sys_snode_t *node)
+{
+	node->next = NULL;
+
+	if (list->tail == NULL) {
+		list->tail = node;
+		K_RCU_ASSIGN_POINTER(list->head, node);
+	} else {
+		K_RCU_ASSIGN_POINTER(list->tail->next, node);
+		list->tail = node;
+	}
+}
+
+/**
+ * @brief Remove a node from a list read by RCU readers.
+ *
+ * The node keeps pointing to its successor, so that readers standing on
+ * it can go on.  It may only be reused or freed after a grace period.
+ * Updaters of the list must still exclude each other.
+ *
+ * @param list A pointer on the list to affect
+ * @param node A pointer on the node to remove
+ *
+ * @return true if the node was removed
+ */
+static inline bool k_rcu_slist_find_and_remove(sys_slist_t *list,
+					       sys_snode_t *node)
+{
+	sys_snode_t *prev = NULL;
+	sys_snode_t *test;
+
+	SYS_SLIST_FOR_EACH_NODE(list, test) {
+		if (test != node) {
+			prev = test;
+			continue;
+		}
+
+		if (prev == NULL) {
+			K_RCU_DEREFERENCE(list->head) = node->next;
+		} else {
+			K_RCU_DEREFERENCE(prev->next) = node->next;
+		}
+
+		if (list->tail == node) {
+			list->tail = prev;
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * @brief Iterate over the containers of a list read by RCU readers.
+ *
+ * To be used inside a read-side critical section.
+ *
+ * @param __sl A pointer on the list to iterate on
+ * @param __cn A pointer to peek each container
+ * @param __n The field name of sys_snode_t within the containers
+ */
+#define K_RCU_SLIST_FOR_EACH_CONTAINER(__sl, __cn, __n)                        \
+	for (sys_snode_t *__rcu_node = K_RCU_DEREFERENCE((__sl)->head);        \
+	     (__rcu_node != NULL) &&                                           \
+	     ((__cn) = CONTAINER_OF(__rcu_node, __typeof__(*(__cn)), __n),     \
+	      true);                                                           \
+	     __rcu_node = K_RCU_DEREFERENCE(__rcu_node->next))
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_KERNEL_RCU_H_ */
@@ -30,4 +30,29 @@ struct k_cycle_stats {
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
+#if defined(CONFIG_SCHED_THREAD_LATENCY) || defined(__DOXYGEN__)
+/**
+ * Structure used to track the scheduling latency of a thread.
+ *
+ * Bucket @c i > 0 of the histogram counts the latencies of
+ * 2^(CONFIG_SCHED_THREAD_LATENCY_SHIFT + i - 1) cycles up to twice that,
+ * bucket 0 the shorter ones, and the last bucket all the longer ones.
+ */
+struct k_latency_stats {
+	uint32_t  ready;        /**< cycle stamp when made ready, 0 if running */
+	uint32_t  preemptions;  /**< \# of times switched out while ready */
+	uint32_t  longest;      /**< longest ready-to-running latency in cycles */
+	/** histogram of ready-to-running latencies */
+	uint32_t  hist[CONFIG_SCHED_THREAD_LATENCY_BUCKETS];
+};
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+
+/**
+ * Structure used to track the floating point context switches of a thread.
+ */
+struct k_float_stats {
+	uint32_t  saves;        /**< \# of times the FP context was saved */
+	uint32_t  restores;     /**< \# of times the FP context was restored */
+};
+
 #endif /* ZEPHYR_INCLUDE_KERNEL_STATS_H_ */
@@ -135,6 +135,25 @@ struct _thread_base {
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	struct k_cycle_stats  usage;   /* Track thread usage statistics */
 #endif /* CONFIG_SCHED_THREAD_USAGE */
+
+#ifdef CONFIG_SCHED_THREAD_LATENCY
+	struct k_latency_stats latency; /* Track scheduling latency */
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+
+#ifdef CONFIG_FPU_SHARING_STATS
+	struct k_float_stats fp_stats;  /* Track FP context switches */
+#endif /* CONFIG_FPU_SHARING_STATS */
+
+#ifdef CONFIG_RCU
+	/* RCU read-side critical section nesting depth */
+	uint16_t rcu_nesting;
+
+	/* Switched out inside a read-side critical section */
+	bool rcu_blocked;
+
+	/* Grace period held up while rcu_blocked is set */
+	uint32_t rcu_gp;
+#endif /* CONFIG_RCU */
 };
 
 typedef struct _thread_base _thread_base_t;
@@ -228,6 +247,17 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY
+	/*
+	 * Scheduling latency of a thread, see struct k_latency_stats for
+	 * the layout of the histogram.  Always zero for CPUs.
+	 */
+
+	uint32_t preemptions;         /* # of times switched out while ready */
+	uint32_t peak_latency_cycles; /* longest ready-to-running latency */
+	uint32_t latency_hist[CONFIG_SCHED_THREAD_LATENCY_BUCKETS];
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
 	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
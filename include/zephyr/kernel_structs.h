@@ -200,6 +200,14 @@ struct _cpu {
 	sys_dlist_t ipi_workq;
 #endif
 
+#ifdef CONFIG_RCU
+	/* RCU read-side critical section nesting depth of ISRs */
+	uint32_t rcu_isr_nesting;
+
+	/* Last RCU grace period this CPU went through a quiescent state in */
+	uint32_t rcu_qs_gp;
+#endif
+
 	/* Per CPU architecture specifics */
 	struct _cpu_arch arch;
 };
@@ -301,7 +309,15 @@ struct _timeout;
 typedef void (*_timeout_func_t)(struct _timeout *t);
 
 struct _timeout {
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+	struct rbnode node;
+	/* Absolute tick of expiry, the sort key of the timeout tree */
+	uint64_t expiry;
+	/* Insertion order among equal expiries, zero when not queued */
+	uint64_t order_key;
+#else
 	sys_dnode_t node;
+#endif
 	_timeout_func_t fn;
 #ifdef CONFIG_TIMEOUT_64BIT
 	/* Can't use k_ticks_t for header dependency reasons */
@@ -309,6 +325,14 @@ struct _timeout {
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* Ticks the expiry may be deferred by to share a wakeup */
+#ifdef CONFIG_TIMEOUT_64BIT
+	int64_t slack;
+#else
+	uint32_t slack;
+#endif
+#endif /* CONFIG_TIMEOUT_SLACK */
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
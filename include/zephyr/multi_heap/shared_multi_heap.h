@@ -98,6 +98,13 @@ struct shared_multi_heap_region {
 
 	/** Memory heap size in bytes */
 	size_t size;
+
+	/**
+	 * CPUs the memory is local to, 0 if it is shared by all of them.
+	 * Only used with CONFIG_MULTI_HEAP_AFFINITY, to allocate memory
+	 * from the regions closest to the current CPU first.
+	 */
+	uint32_t cpu_mask;
 };
 
 /**
@@ -960,6 +960,32 @@ struct ifreq {
 #define TCP_KEEPINTVL 3
 /** Number of keepalives before dropping connection */
 #define TCP_KEEPCNT 4
+/** Get information about the connection, see struct tcp_info (get only) */
+#define TCP_INFO 5
+
+/** Timestamps are in use on the connection */
+#define TCPI_OPT_TIMESTAMPS BIT(0)
+/** Selective acknowledgments are in use on the connection */
+#define TCPI_OPT_SACK BIT(1)
+
+/**
+ * @brief TCP connection information.
+ *
+ * Returned by the TCP_INFO socket option. The round-trip time values are
+ * only measured if timestamps are in use on the connection, and are 0
+ * otherwise.
+ */
+struct tcp_info {
+	uint8_t  tcpi_options;     /**< TCPI_OPT_* options in use */
+	uint8_t  tcpi_retransmits; /**< Retransmissions of the oldest unacknowledged data */
+	uint32_t tcpi_rto;         /**< Retransmission timeout (in microseconds) */
+	uint32_t tcpi_snd_mss;     /**< Maximum segment size sent */
+	uint32_t tcpi_rcv_mss;     /**< Maximum segment size received */
+	uint32_t tcpi_rtt;         /**< Smoothed round-trip time (in microseconds) */
+	uint32_t tcpi_rttvar;      /**< Round-trip time variation (in microseconds) */
+	uint32_t tcpi_snd_cwnd;    /**< Congestion window (in bytes), 0 if not used */
+	uint32_t tcpi_snd_wnd;     /**< Window advertised by the peer (in bytes) */
+};
 
 /** @} */
 
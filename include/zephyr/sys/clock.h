@@ -64,6 +64,10 @@ typedef uint32_t k_ticks_t;
  */
 typedef struct {
 	k_ticks_t ticks;
+#if defined(CONFIG_TIMEOUT_SLACK) || defined(__DOXYGEN__)
+	/** Ticks the expiry may be deferred by, see K_TIMEOUT_SLACK() */
+	k_ticks_t slack;
+#endif
 } k_timeout_t;
 
 /**
@@ -79,6 +83,29 @@ typedef struct {
  */
 #define K_TIMEOUT_EQ(a, b) ((a).ticks == (b).ticks)
 
+/**
+ * @brief Allow a timeout to expire late
+ *
+ * Generates a timeout equal to @p t, except that the kernel may defer its
+ * expiry by up to the duration of @p slack, so that it expires together
+ * with other timeouts and the system wakes up less often from tickless
+ * idle.  The timeout never expires before @p t.  Timeouts built without
+ * this macro have no slack.
+ *
+ * Without @kconfig{CONFIG_TIMEOUT_SLACK} the slack is ignored.
+ *
+ * @param t Timeout, e.g. K_MSEC(100)
+ * @param slack Timeout giving the allowed delay, e.g. K_MSEC(10)
+ * @return Timeout expiring between @p t and @p t + @p slack
+ */
+#if defined(CONFIG_TIMEOUT_SLACK) && defined(__cplusplus) && ((__cplusplus - 0) < 202002L)
+#define K_TIMEOUT_SLACK(t, slack) ((k_timeout_t) {(t).ticks, (slack).ticks})
+#elif defined(CONFIG_TIMEOUT_SLACK)
+#define K_TIMEOUT_SLACK(t, slack) ((k_timeout_t) {.ticks = (t).ticks, .slack = (slack).ticks})
+#else
+#define K_TIMEOUT_SLACK(t, slack) (t)
+#endif
+
 /** number of nanoseconds per microsecond */
 #define NSEC_PER_USEC 1000U
 
@@ -233,6 +260,40 @@ int64_t sys_clock_tick_get(void);
 #define sys_clock_tick_get_32() (0)
 #endif
 
+#if defined(CONFIG_TIMEOUT_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Statistics of the kernel timeouts
+ *
+ * @see sys_clock_timeout_stats_get()
+ */
+struct sys_clock_timeout_stats {
+	/** Number of times the system timer was programmed for a timeout */
+	uint32_t reprograms;
+	/** Number of timeouts deferred by their slack to a later wakeup */
+	uint32_t coalesced;
+};
+
+/**
+ * @brief Get the statistics of the kernel timeouts
+ *
+ * Counting the reprogramming of the system timer and the timeouts whose
+ * expiry was coalesced with a later one shows how much
+ * K_TIMEOUT_SLACK() saves.  Idle entries are not counted.
+ *
+ * @kconfig_dep{CONFIG_TIMEOUT_STATS}
+ *
+ * @param stats Filled with the counts since boot or the last reset
+ */
+void sys_clock_timeout_stats_get(struct sys_clock_timeout_stats *stats);
+
+/**
+ * @brief Reset the statistics of the kernel timeouts
+ *
+ * @kconfig_dep{CONFIG_TIMEOUT_STATS}
+ */
+void sys_clock_timeout_stats_reset(void);
+#endif /* CONFIG_TIMEOUT_STATS */
+
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 
 /**
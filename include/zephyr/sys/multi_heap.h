@@ -5,6 +5,7 @@
 #ifndef ZEPHYR_INCLUDE_SYS_MULTI_HEAP_H_
 #define ZEPHYR_INCLUDE_SYS_MULTI_HEAP_H_
 
+#include <stdbool.h>
 #include <zephyr/types.h>
 
 #define MAX_MULTI_HEAPS 8
@@ -58,17 +59,58 @@ typedef void *(*sys_multi_heap_fn_t)(struct sys_multi_heap *mheap, void *cfg,
 				     size_t align, size_t size);
 
 
+/**
+ * @brief Multi-heap region statistics
+ *
+ * Kept for each heap of a multi heap by sys_multi_heap_affinity_alloc().
+ */
+struct sys_multi_heap_region_stats {
+	/** Allocations served by the heap */
+	uint32_t allocs;
+
+	/** Allocations served by the heap after the first heap tried for
+	 * them, preferred by or local to the CPU, was full
+	 */
+	uint32_t fallbacks;
+};
+
 struct sys_multi_heap_rec {
 	struct sys_heap *heap;
 	void *user_data;
+#ifdef CONFIG_MULTI_HEAP_AFFINITY
+	/* CPUs the heap is local to, 0 if it is shared by all of them */
+	uint32_t cpu_mask;
+	struct sys_multi_heap_region_stats stats;
+#endif
 };
 
 struct sys_multi_heap {
 	unsigned int nheaps;
 	sys_multi_heap_fn_t choice;
 	struct sys_multi_heap_rec heaps[MAX_MULTI_HEAPS];
+#ifdef CONFIG_MULTI_HEAP_AFFINITY
+	/* Heap each CPU tries first, or NULL */
+	struct sys_heap *preferred[CONFIG_MP_MAX_NUM_CPUS];
+
+	/* Indexes in heaps[], in the order each CPU tries them */
+	uint8_t chain[CONFIG_MP_MAX_NUM_CPUS][MAX_MULTI_HEAPS];
+#endif
 };
 
+/**
+ * @brief Multi-heap filter function
+ *
+ * Used by sys_multi_heap_affinity_alloc() to skip the heaps that do not
+ * fit the opaque cfg value, for example the heaps without the capabilities
+ * it specifies.
+ *
+ * @param rec Heap record
+ * @param cfg The opaque value passed to sys_multi_heap_affinity_alloc()
+ * @return true if the allocation may be served by the heap
+ */
+typedef bool (*sys_multi_heap_filter_fn_t)(const struct sys_multi_heap_rec *rec,
+					   void *cfg);
+
 /**
  * @brief Initialize multi-heap
  *
@@ -194,6 +236,97 @@ void *sys_multi_heap_aligned_realloc(struct sys_multi_heap *mheap, void *cfg,
 #define sys_multi_heap_realloc(mheap, cfg, ptr, bytes) \
 	sys_multi_heap_aligned_realloc(mheap, cfg, ptr, 0, bytes)
 
+#if defined(CONFIG_MULTI_HEAP_AFFINITY) || defined(__DOXYGEN__)
+
+/**
+ * @brief Set the CPUs a heap of a multi heap is local to
+ *
+ * The heaps local to a CPU, typically close memories with a short
+ * latency, are tried by sys_multi_heap_affinity_alloc() before the heaps
+ * shared by all the CPUs, which in turn are tried before the heaps local
+ * to other CPUs.  Heaps are shared by all the CPUs until this is called.
+ *
+ * @param mheap Multi heap pointer
+ * @param heap A heap previously added with sys_multi_heap_add_heap()
+ * @param cpu_mask Bitmask of the CPUs, 0 if the heap is shared by all the
+ *                 CPUs
+ * @retval 0 on success
+ * @retval -ENOENT if the heap is not part of the multi heap
+ */
+int sys_multi_heap_set_affinity(struct sys_multi_heap *mheap,
+				struct sys_heap *heap, uint32_t cpu_mask);
+
+/**
+ * @brief Set the heap of a multi heap preferred by a CPU
+ *
+ * The preferred heap is tried by sys_multi_heap_affinity_alloc() before
+ * any other heap when running on the CPU.
+ *
+ * @param mheap Multi heap pointer
+ * @param cpu CPU index
+ * @param heap A heap previously added with sys_multi_heap_add_heap(), or
+ *             NULL for no preferred heap
+ * @retval 0 on success
+ * @retval -EINVAL if the CPU index is invalid
+ * @retval -ENOENT if the heap is not part of the multi heap
+ */
+int sys_multi_heap_set_preferred(struct sys_multi_heap *mheap,
+				 unsigned int cpu, struct sys_heap *heap);
+
+/**
+ * @brief Allocate memory from the heaps closest to the current CPU
+ *
+ * Tries the heaps of @a mheap in the order of the fallback chain of the
+ * current CPU: its preferred heap, the heaps local to it, the heaps shared
+ * by all the CPUs, then the heaps local to other CPUs.  Heaps of the same
+ * class are tried in memory order.  This is meant to be called by choice
+ * functions.
+ *
+ * @param mheap Multi heap pointer
+ * @param filter Function skipping the heaps that do not fit @a cfg, or
+ *               NULL to try all of them
+ * @param cfg Opaque configuration parameter passed to @a filter
+ * @param align Power of two alignment for the returned pointer, in bytes
+ * @param bytes Requested size of the allocation, in bytes
+ * @return A valid pointer to heap memory, or NULL if no memory is available
+ */
+void *sys_multi_heap_affinity_alloc(struct sys_multi_heap *mheap,
+				    sys_multi_heap_filter_fn_t filter,
+				    void *cfg, size_t align, size_t bytes);
+
+/**
+ * @brief Choice function allocating from the heaps closest to the CPU
+ *
+ * A sys_multi_heap_fn_t that ignores its cfg value and allocates with
+ * sys_multi_heap_affinity_alloc() from any heap.
+ *
+ * @param mheap Multi heap pointer
+ * @param cfg Ignored
+ * @param align Alignment of requested memory (or zero for no alignment)
+ * @param size The user-specified allocation size in bytes
+ * @return A pointer to the allocated memory
+ */
+void *sys_multi_heap_affinity_choice(struct sys_multi_heap *mheap, void *cfg,
+				     size_t align, size_t size);
+
+/**
+ * @brief Get the statistics of a heap of a multi heap
+ *
+ * The memory usage of the heap itself is reported by
+ * sys_heap_runtime_stats_get().
+ *
+ * @param mheap Multi heap pointer
+ * @param heap A heap previously added with sys_multi_heap_add_heap()
+ * @param stats Pointer to the statistics to fill
+ * @retval 0 on success
+ * @retval -ENOENT if the heap is not part of the multi heap
+ */
+int sys_multi_heap_region_stats_get(const struct sys_multi_heap *mheap,
+				    const struct sys_heap *heap,
+				    struct sys_multi_heap_region_stats *stats);
+
+#endif /* CONFIG_MULTI_HEAP_AFFINITY */
+
 /**
  * @}
  */
@@ -11,9 +11,12 @@
  * sys_mutex behaves almost exactly like k_mutex, with the added advantage
  * that a sys_mutex instance can reside in user memory.
  *
- * Further enhancements will support locking/unlocking uncontended sys_mutexes
- * with simple atomic ops instead of syscalls, similar to Linux's
- * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI
+ * Uncontended sys_mutexes are locked and unlocked with atomic operations on
+ * user memory, without any system call, when user threads find their own
+ * thread ID in thread local storage (CONFIG_CURRENT_THREAD_USE_TLS).  The
+ * kernel is only entered when a thread has to wait for the mutex, or when its
+ * owner has to wake waiters up, similar to Linux's FUTEX_LOCK_PI and
+ * FUTEX_UNLOCK_PI.
  */
 
 #ifdef __cplusplus
@@ -21,16 +24,26 @@ extern "C" {
 #endif
 
 #ifdef CONFIG_USERSPACE
+#include <errno.h>
+#include <zephyr/kernel.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
 #include <zephyr/types.h>
 #include <zephyr/sys_clock.h>
 
+/** @cond INTERNAL_HIDDEN */
+
+/* Set in sys_mutex::val when threads wait for the mutex in the kernel */
+#define SYS_MUTEX_WAITERS BIT(0)
+
+/** @endcond */
+
 struct sys_mutex {
-	/* Currently unused, but will be used to store state for fast mutexes
-	 * that can be locked/unlocked with atomic ops if there is no
-	 * contention
-	 */
+	/* Owner thread, or 0 if unlocked, with SYS_MUTEX_WAITERS */
 	atomic_t val;
+
+	/* Lock count, only used by the owner */
+	uint32_t lock_count;
 };
 
 /**
@@ -89,6 +102,10 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  * A thread is permitted to lock a mutex it has already locked. The operation
  * completes immediately and the lock count is increased by 1.
  *
+ * With CONFIG_CURRENT_THREAD_USE_TLS, a user thread locks the mutex without
+ * any system call if it is not locked by another thread.  It then faults if
+ * it has no access to the mutex.
+ *
  * @param mutex Address of the mutex, which may reside in user memory
  * @param timeout Waiting period to lock the mutex,
  *                or one of the special values K_NO_WAIT and K_FOREVER.
@@ -96,12 +113,41 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  * @retval 0 Mutex locked.
  * @retval -EBUSY Returned without waiting.
  * @retval -EAGAIN Waiting period timed out.
- * @retval -EACCES Caller has no access to provided mutex address
- * @retval -EINVAL Provided mutex not recognized by the kernel
+ * @retval -EACCES Caller has no access to provided mutex address, when it
+ *                 makes a system call to lock it
+ * @retval -EINVAL Provided mutex, or the thread owning it, not recognized by
+ *                 the kernel
+ * @retval -EPERM Caller has no permission on the thread owning the mutex
  */
 static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
-	/* For now, make the syscall unconditionally */
+	atomic_val_t self;
+	atomic_val_t val;
+
+	if (!IS_ENABLED(CONFIG_CURRENT_THREAD_USE_TLS) || !k_is_user_context()) {
+		/* No privilege transition to save, as finding the current
+		 * thread would take a system call of its own
+		 */
+		return z_sys_mutex_kernel_lock(mutex, timeout);
+	}
+
+	self = (atomic_val_t)k_current_get();
+	val = atomic_get(&mutex->val);
+
+	if ((val & ~SYS_MUTEX_WAITERS) == self) {
+		mutex->lock_count++;
+		return 0;
+	}
+
+	if ((val == 0) && atomic_cas(&mutex->val, 0, self)) {
+		mutex->lock_count = 1U;
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return -EBUSY;
+	}
+
 	return z_sys_mutex_kernel_lock(mutex, timeout);
 }
 
@@ -115,16 +161,46 @@ static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
  * the calling thread as many times as it was previously locked by that
  * thread.
  *
+ * With CONFIG_CURRENT_THREAD_USE_TLS, a user thread unlocks the mutex without
+ * any system call if no thread waits for it.  It then faults if it has no
+ * access to the mutex.
+ *
  * @param mutex Address of the mutex, which may reside in user memory
  * @retval 0 Mutex unlocked
- * @retval -EACCES Caller has no access to provided mutex address
+ * @retval -EACCES Caller has no access to provided mutex address, when it
+ *                 makes a system call to unlock it
  * @retval -EINVAL Provided mutex not recognized by the kernel or mutex wasn't
  *                 locked
  * @retval -EPERM Caller does not own the mutex
  */
 static inline int sys_mutex_unlock(struct sys_mutex *mutex)
 {
-	/* For now, make the syscall unconditionally */
+	atomic_val_t self;
+	atomic_val_t val;
+
+	if (!IS_ENABLED(CONFIG_CURRENT_THREAD_USE_TLS) || !k_is_user_context()) {
+		return z_sys_mutex_kernel_unlock(mutex);
+	}
+
+	self = (atomic_val_t)k_current_get();
+	val = atomic_get(&mutex->val);
+
+	if ((val & ~SYS_MUTEX_WAITERS) != self) {
+		return (val == 0) ? -EINVAL : -EPERM;
+	}
+
+	if (mutex->lock_count > 1U) {
+		mutex->lock_count--;
+		return 0;
+	}
+
+	mutex->lock_count = 0U;
+
+	if ((val == self) && atomic_cas(&mutex->val, self, 0)) {
+		return 0;
+	}
+
+	/* Hand the mutex over to the highest priority waiter */
 	return z_sys_mutex_kernel_unlock(mutex);
 }
 
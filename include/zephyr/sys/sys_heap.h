@@ -65,6 +65,7 @@ struct z_heap_stress_result {
 	uint32_t successful_allocs;
 	uint32_t total_frees;
 	uint64_t accumulated_in_use_bytes;
+	uint32_t ops_per_sec;
 };
 
 /**
@@ -218,6 +219,65 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
  */
 size_t sys_heap_usable_size(struct sys_heap *heap, void *mem);
 
+#if defined(CONFIG_SYS_HEAP_CACHE) || defined(__DOXYGEN__)
+/** @brief Allocate memory from the per-CPU caches of a sys_heap
+ *
+ * Returns a block of exactly the size a sys_heap_alloc() call for
+ * @a bytes would use, if the current CPU has one cached.  Unlike the
+ * other sys_heap calls, this does not access the heap itself and
+ * needs no lock to be held by the caller.  The block is freed with
+ * sys_heap_cache_free() or sys_heap_free().
+ *
+ * @param heap Heap from which to allocate
+ * @param bytes Number of bytes requested
+ * @return Pointer to memory the caller can now use, or NULL
+ */
+void *sys_heap_cache_alloc(struct sys_heap *heap, size_t bytes);
+
+/** @brief Free memory into the per-CPU caches of a sys_heap
+ *
+ * Keeps a small block in the cache of the current CPU instead of
+ * returning it to the heap.  Like sys_heap_cache_alloc(), this needs
+ * no lock to be held by the caller.  Blocks from aligned allocations,
+ * large blocks, and blocks freed while the caches are full or
+ * disabled are not cached, and must be freed with sys_heap_free().
+ *
+ * @param heap Heap to which to return the memory
+ * @param mem A pointer previously returned from one of the sys_heap
+ *            allocation calls
+ * @return true if the block was cached or @a mem is NULL, false if
+ *         the block must be freed with sys_heap_free()
+ */
+bool sys_heap_cache_free(struct sys_heap *heap, void *mem);
+
+/** @brief Return all cached blocks to a sys_heap
+ *
+ * Allocations that fail otherwise do this automatically, so this is
+ * only needed to make the cached memory available for merging with
+ * its neighbors right away.  Must be serialized with the other heap
+ * operations like sys_heap_free().
+ *
+ * @param heap Heap whose caches to flush
+ */
+void sys_heap_cache_flush(struct sys_heap *heap);
+
+/** @brief Stop caching freed blocks of a sys_heap
+ *
+ * Makes sys_heap_cache_free() refuse all blocks until the matching
+ * sys_heap_cache_enable() call.  Calls can be nested.  Used when a
+ * thread needs to be woken up by the next sys_heap_free() call.
+ *
+ * @param heap Heap whose caches to disable
+ */
+void sys_heap_cache_disable(struct sys_heap *heap);
+
+/** @brief Resume caching freed blocks of a sys_heap
+ *
+ * @param heap Heap whose caches to enable
+ */
+void sys_heap_cache_enable(struct sys_heap *heap);
+#endif
+
 /** @brief Validate heap integrity
  *
  * Validates the internal integrity of a sys_heap.  Intended for unit
@@ -250,7 +310,8 @@ static inline bool sys_heap_validate(struct sys_heap *heap)
  * target_percent full.  Allocation and free operations are provided
  * by the caller as callbacks (i.e. this can in theory test any heap).
  * Results, including counts of frees and successful/unsuccessful
- * allocations, are returned via the @a result struct.
+ * allocations and the number of operations per second, are returned
+ * via the @a result struct.
  *
  * @param alloc_fn Callback to perform an allocation.  Passes back the @a
  *              arg parameter as a context handle.
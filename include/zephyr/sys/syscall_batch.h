@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+#define ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/syscall.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup syscall_batch_apis System call batching APIs
+ * @ingroup usermode_apis
+ * @{
+ */
+
+/**
+ * @brief One operation of a system call batch
+ *
+ * The operation is identified by the ID of the system call it stands for.
+ * The supported ones are:
+ *
+ * - K_SYSCALL_K_SEM_GIVE: k_sem_give(arg1)
+ * - K_SYSCALL_K_SEM_TAKE: k_sem_take(arg1, K_NO_WAIT)
+ * - K_SYSCALL_K_MSGQ_PUT: k_msgq_put(arg1, arg2, K_NO_WAIT)
+ * - K_SYSCALL_K_MSGQ_GET: k_msgq_get(arg1, arg2, K_NO_WAIT)
+ * - K_SYSCALL_K_POLL_SIGNAL_RAISE: k_poll_signal_raise(arg1, arg2),
+ *   if CONFIG_POLL is enabled
+ */
+struct k_syscall_batch_entry {
+	/** ID of the system call, K_SYSCALL_xxx */
+	uint32_t id;
+
+	/** Return value of the operation, set by k_syscall_batch() */
+	int ret;
+
+	/** First argument, the kernel object */
+	uintptr_t arg1;
+
+	/** Second argument, if any */
+	uintptr_t arg2;
+};
+
+/**
+ * @brief Initializer for one operation of a system call batch
+ *
+ * @param _id ID of the system call, K_SYSCALL_xxx.
+ * @param _obj Kernel object the operation applies to.
+ * @param _arg Second argument of the operation, or 0.
+ */
+#define K_SYSCALL_BATCH_ENTRY(_id, _obj, _arg) \
+	{ \
+	.id = (_id), \
+	.ret = 0, \
+	.arg1 = (uintptr_t)(_obj), \
+	.arg2 = (uintptr_t)(_arg), \
+	}
+
+/**
+ * @brief Run several kernel object operations in one system call
+ *
+ * The operations of @a entries run in order, exactly as if they were
+ * called one after another, and the return value of each one is stored in
+ * its ret field. Operations that could block are run with K_NO_WAIT.
+ * An entry with an unsupported ID gets -ENOSYS.
+ *
+ * When called from user mode, the kernel objects referenced by the batch
+ * are only validated once per call, and a thread without permission on one
+ * of them is terminated, as with the individual system calls.
+ *
+ * @param entries Operations to run.
+ * @param num_entries Number of operations in @a entries.
+ *
+ * @return Number of operations that returned an error.
+ */
+__syscall int k_syscall_batch(struct k_syscall_batch_entry *entries,
+			      size_t num_entries);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <zephyr/syscalls/syscall_batch.h>
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_ */
@@ -146,7 +146,6 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 				  uint32_t events_mask)
 {
 	k_spinlock_key_t  key;
-	struct k_thread  *thread;
 	struct event_walk_data data;
 	uint32_t previous_events;
 
@@ -163,11 +162,10 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	/*
 	 * Posting an event has the potential to wake multiple pended threads.
 	 * It is desirable to unpend all affected threads simultaneously. This
-	 * is done in three steps:
+	 * is done in two steps:
 	 *
 	 * 1. Walk the waitq and create a linked list of threads to unpend.
-	 * 2. Unpend each of the threads in the linked list
-	 * 3. Ready each of the threads in the linked list
+	 * 2. Unpend and ready all the threads in the linked list at once
 	 */
 
 	data.events = events;
@@ -175,14 +173,7 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
 
 	if (data.head != NULL) {
-		thread = data.head;
-		struct k_thread *next;
-		do {
-			arch_thread_return_value_set(thread, 0);
-			next = thread->next_event_link;
-			z_sched_wake_thread(thread, false);
-			thread = next;
-		} while (thread != NULL);
+		z_sched_wake_event_threads(data.head, 0);
 	}
 
 	/* stash any events not consumed */
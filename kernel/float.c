@@ -29,6 +29,20 @@ int z_impl_k_float_enable(struct k_thread *thread, unsigned int options)
 #endif /* CONFIG_FPU && CONFIG_FPU_SHARING */
 }
 
+int z_impl_k_float_stats_get(struct k_thread *thread, struct k_float_stats *stats)
+{
+#ifdef CONFIG_FPU_SHARING_STATS
+	/* The counts only grow, and may change under our feet anyway */
+	*stats = thread->base.fp_stats;
+
+	return 0;
+#else
+	ARG_UNUSED(thread);
+	ARG_UNUSED(stats);
+	return -ENOTSUP;
+#endif /* CONFIG_FPU_SHARING_STATS */
+}
+
 #ifdef CONFIG_USERSPACE
 static inline int z_vrfy_k_float_disable(struct k_thread *thread)
 {
@@ -44,4 +58,13 @@ static inline int z_vrfy_k_float_enable(struct k_thread *thread, unsigned int op
 }
 #include <zephyr/syscalls/k_float_enable_mrsh.c>
 
+static inline int z_vrfy_k_float_stats_get(struct k_thread *thread,
+					   struct k_float_stats *stats)
+{
+	K_OOPS(K_SYSCALL_OBJ(thread, K_OBJ_THREAD));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(stats, sizeof(*stats)));
+	return z_impl_k_float_stats_get(thread, stats);
+}
+#include <zephyr/syscalls/k_float_stats_get_mrsh.c>
+
 #endif /* CONFIG_USERSPACE */
@@ -50,6 +50,11 @@ void idle(void *unused1, void *unused2, void *unused3)
 		 */
 		(void) arch_irq_lock();
 
+		/* The idle thread never is in an RCU read-side critical
+		 * section.
+		 */
+		z_rcu_quiescent();
+
 #ifdef CONFIG_PM
 		_kernel.idle = z_get_next_timeout_expiry();
 
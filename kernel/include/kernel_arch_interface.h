@@ -221,6 +221,41 @@ int arch_float_disable(struct k_thread *thread);
 int arch_float_enable(struct k_thread *thread, unsigned int options);
 #endif /* CONFIG_FPU && CONFIG_FPU_SHARING */
 
+/**
+ * @brief Account for a save of the floating point context of a thread
+ *
+ * To be called by architectures selecting
+ * @kconfig{CONFIG_ARCH_HAS_FPU_SHARING_STATS}, each time the floating point
+ * registers are saved to the context of @a thread.
+ *
+ * @param thread Thread whose floating point context was saved
+ */
+static inline void z_float_context_saved(struct k_thread *thread)
+{
+#ifdef CONFIG_FPU_SHARING_STATS
+	thread->base.fp_stats.saves++;
+#else
+	ARG_UNUSED(thread);
+#endif /* CONFIG_FPU_SHARING_STATS */
+}
+
+/**
+ * @brief Account for a restore of the floating point context of a thread
+ *
+ * Counterpart of z_float_context_saved(), to be called each time the
+ * floating point registers are loaded from the context of @a thread.
+ *
+ * @param thread Thread whose floating point context was restored
+ */
+static inline void z_float_context_restored(struct k_thread *thread)
+{
+#ifdef CONFIG_FPU_SHARING_STATS
+	thread->base.fp_stats.restores++;
+#else
+	ARG_UNUSED(thread);
+#endif /* CONFIG_FPU_SHARING_STATS */
+}
+
 /**
  * @brief Disable coprocessor context preservation
  *
@@ -143,6 +143,39 @@ void z_mem_domain_exit_thread(struct k_thread *thread);
  * not recommended.
  */
 extern struct k_spinlock z_mem_domain_lock;
+
+/**
+ * @brief Wait for a sys_mutex locked in user mode
+ *
+ * Makes @a mutex, the kernel mutex backing the sys_mutex, the owner of the
+ * mutex value @a val if it is not yet, so that the owner inherits the
+ * priority of the waiters, then waits for the owner to hand the sys_mutex
+ * over.
+ *
+ * @param mutex Kernel mutex of the sys_mutex
+ * @param val Value of the sys_mutex
+ * @param old Value read by the caller, whose owner thread was validated
+ * @param timeout Waiting period
+ *
+ * @retval 0 Mutex locked
+ * @retval 1 @a val changed since the caller read it
+ * @retval -EAGAIN Waiting period timed out
+ * @retval -EINVAL The owner thread has exited
+ */
+int z_mutex_user_lock(struct k_mutex *mutex, atomic_t *val, atomic_val_t old,
+		      k_timeout_t timeout);
+
+/**
+ * @brief Hand a sys_mutex over to the highest priority waiter
+ *
+ * @param mutex Kernel mutex of the sys_mutex
+ * @param val Value of the sys_mutex
+ *
+ * @retval 0 Mutex unlocked
+ * @retval -EINVAL Mutex not locked
+ * @retval -EPERM Current thread does not own the mutex
+ */
+int z_mutex_user_unlock(struct k_mutex *mutex, atomic_t *val);
 #endif /* CONFIG_USERSPACE */
 
 #ifdef CONFIG_GDBSTUB
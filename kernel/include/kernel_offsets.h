@@ -50,6 +50,11 @@ GEN_OFFSET_SYM(_ready_q_t, cache);
 
 GEN_OFFSET_SYM(_thread_base_t, user_options);
 
+#ifdef CONFIG_FPU_SHARING_STATS
+GEN_NAMED_OFFSET_SYM(_thread_base_t, fp_stats.saves, fp_saves);
+GEN_NAMED_OFFSET_SYM(_thread_base_t, fp_stats.restores, fp_restores);
+#endif /* CONFIG_FPU_SHARING_STATS */
+
 GEN_OFFSET_SYM(_thread_t, base);
 GEN_OFFSET_SYM(_thread_t, callee_saved);
 GEN_OFFSET_SYM(_thread_t, arch);
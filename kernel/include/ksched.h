@@ -228,27 +228,29 @@ void z_sched_wake_thread(struct k_thread *thread, bool is_timeout);
 /**
  * Wake up all threads pending on the provided wait queue
  *
- * Convenience function to invoke z_sched_wake() on all threads in the queue
- * until there are no more to wake up.
+ * Equivalent to invoking z_sched_wake() until there are no more threads to
+ * wake up, but the threads are all made ready under a single hold of the
+ * scheduler lock, with at most one IPI flagged per CPU.
  *
- * @param wait_q Wait queue to wake up the highest prio thread
- * @param swap_retval Swap return value for woken thread
+ * @param wait_q Wait queue to wake up the threads of
+ * @param swap_retval Swap return value for woken threads
  * @param swap_data Data return value to supplement swap_retval. May be NULL.
- * @retval true If any threads were woken up
- * @retval false If the wait_q was empty
+ * @return Number of threads woken up, 0 if the wait_q was empty
  */
-static inline bool z_sched_wake_all(_wait_q_t *wait_q, int swap_retval,
-				    void *swap_data)
-{
-	bool woken = false;
+int z_sched_wake_all(_wait_q_t *wait_q, int swap_retval, void *swap_data);
 
-	while (z_sched_wake(wait_q, swap_retval, swap_data)) {
-		woken = true;
-	}
-
-	/* True if we woke at least one thread up */
-	return woken;
-}
+#ifdef CONFIG_EVENTS
+/**
+ * Wake up a list of threads pending on an event
+ *
+ * The threads, linked through their next_event_link, are all made ready
+ * under a single hold of the scheduler lock.
+ *
+ * @param head First thread of the list
+ * @param swap_retval Swap return value for woken threads
+ */
+void z_sched_wake_event_threads(struct k_thread *head, int swap_retval);
+#endif /* CONFIG_EVENTS */
 
 /**
  * Atomically put the current thread to sleep on a wait queue, with timeout
@@ -335,4 +337,98 @@ static inline void z_sched_usage_switch(struct k_thread *thread)
 #endif /* CONFIG_SCHED_THREAD_USAGE */
 }
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY
+/**
+ * @brief Record that a thread was made ready to run
+ *
+ * Called with the scheduler lock held when the thread is queued.
+ */
+void z_sched_latency_ready(struct k_thread *thread);
+
+/**
+ * @brief Record the scheduling latency at a context switch
+ *
+ * Either thread may be NULL when the architecture reports the switch out
+ * and in separately.  Called with interrupts locked.
+ *
+ * @param old_thread Thread switched out, or NULL
+ * @param new_thread Thread switched in, or NULL
+ */
+void z_sched_latency_switch(struct k_thread *old_thread,
+			    struct k_thread *new_thread);
+#else
+#define z_sched_latency_ready(thread) do { } while (false)
+#define z_sched_latency_switch(old_thread, new_thread) do { } while (false)
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+
+#ifdef CONFIG_ADAPTIVE_SPIN
+/*
+ * Helpers for the adaptive spinning of k_mutex and k_sem.  They read the
+ * state of other CPUs without any lock, which is fine for a heuristic
+ * deciding whether to keep busy waiting.
+ */
+
+/* Tells whether the thread is currently running on another CPU */
+static inline bool z_is_thread_running_elsewhere(struct k_thread *thread)
+{
+	return (thread != _current) &&
+	       (_kernel.cpus[thread->base.cpu].current == thread);
+}
+
+/* Tells whether another CPU is running something else than its idle thread */
+static inline bool z_other_cpus_busy(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct k_thread *thread = _kernel.cpus[i].current;
+
+		if ((thread != _current) &&
+		    (thread != _kernel.cpus[i].idle_thread)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* One step of a busy wait done with interrupts enabled */
+static inline void z_adaptive_spin_relax(void)
+{
+	unsigned int key = arch_irq_lock();
+
+	arch_spin_relax();
+	arch_irq_unlock(key);
+}
+
+/* Tells whether a busy wait started at @a start may go on */
+static inline bool z_adaptive_spin_time_left(uint32_t start)
+{
+	return (k_cycle_get_32() - start) < (uint32_t)CONFIG_ADAPTIVE_SPIN_CYCLES;
+}
+#endif /* CONFIG_ADAPTIVE_SPIN */
+
+#ifdef CONFIG_RCU
+/**
+ * @brief Report a context switch to RCU
+ *
+ * The current CPU goes through a quiescent state.  If @a thread is
+ * switched out inside a read-side critical section, it holds up grace
+ * periods until it leaves it.  Called with interrupts locked.
+ *
+ * @param thread Thread switched out
+ */
+void z_rcu_switched_out(struct k_thread *thread);
+
+/**
+ * @brief Report a quiescent state of the current CPU to RCU
+ *
+ * Called from the idle loop with interrupts locked.
+ */
+void z_rcu_quiescent(void);
+#else
+#define z_rcu_switched_out(thread) do { } while (false)
+#define z_rcu_quiescent() do { } while (false)
+#endif /* CONFIG_RCU */
+
 #endif /* ZEPHYR_KERNEL_INCLUDE_KSCHED_H_ */
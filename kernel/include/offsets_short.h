@@ -56,6 +56,14 @@
 #define _thread_offset_to_user_options \
 	(___thread_t_base_OFFSET + ___thread_base_t_user_options_OFFSET)
 
+#ifdef CONFIG_FPU_SHARING_STATS
+#define _thread_offset_to_fp_saves \
+	(___thread_t_base_OFFSET + ___thread_base_t_fp_saves_OFFSET)
+
+#define _thread_offset_to_fp_restores \
+	(___thread_t_base_OFFSET + ___thread_base_t_fp_restores_OFFSET)
+#endif /* CONFIG_FPU_SHARING_STATS */
+
 /* end - threads */
 
 #endif /* ZEPHYR_KERNEL_INCLUDE_OFFSETS_SHORT_H_ */
@@ -27,7 +27,11 @@ extern "C" {
 
 static inline void z_init_timeout(struct _timeout *to)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+	to->order_key = 0U;
+#else
 	sys_dnode_init(&to->node);
+#endif
 }
 
 /* Adds the timeout to the queue.
@@ -40,7 +44,11 @@ int z_abort_timeout(struct _timeout *to);
 
 static inline bool z_is_inactive_timeout(const struct _timeout *to)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+	return to->order_key == 0U;
+#else
 	return !sys_dnode_is_linked(&to->node);
+#endif
 }
 
 static inline bool z_is_aborted_timeout(const struct _timeout *to)
@@ -49,6 +57,18 @@ static inline bool z_is_aborted_timeout(const struct _timeout *to)
 	return to->dticks == TIMEOUT_DTICKS_ABORTED;
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Check whether an expired timeout fired late, thanks to its slack, so as
+ * to share the wakeup of a timeout expiring after it.
+ *
+ * Only valid from the expiry function, before the timeout is added again.
+ */
+static inline bool z_is_merged_timeout(const struct _timeout *to)
+{
+	return (to->dticks < 0) && !z_is_aborted_timeout(to);
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 static inline void z_init_thread_timeout(struct _thread_base *thread_base)
 {
 	z_init_timeout(&thread_base->timeout);
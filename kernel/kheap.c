@@ -83,6 +83,17 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	void *ret = NULL;
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+	if (align == 0U) {
+		ret = sys_heap_cache_alloc(&heap->heap, bytes);
+		if (ret != NULL) {
+			return ret;
+		}
+	}
+
+	bool cache_disabled = false;
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
@@ -97,6 +108,17 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 			break;
 		}
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+		/* Memory freed from now on must wake us up, so keep it
+		 * out of the caches and retry once with what they hold.
+		 */
+		if (!cache_disabled) {
+			sys_heap_cache_disable(&heap->heap);
+			cache_disabled = true;
+			continue;
+		}
+#endif
+
 		if (!blocked_alloc) {
 			blocked_alloc = true;
 
@@ -112,6 +134,12 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 		key = k_spin_lock(&heap->lock);
 	}
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+	if (cache_disabled) {
+		sys_heap_cache_enable(&heap->heap);
+	}
+#endif
+
 	k_spin_unlock(&heap->lock, key);
 	return ret;
 }
@@ -184,6 +212,10 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+	bool cache_disabled = false;
+#endif
+
 	while (ret == NULL) {
 		ret = sys_heap_realloc(&heap->heap, ptr, bytes);
 
@@ -192,11 +224,25 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 			break;
 		}
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+		if (!cache_disabled) {
+			sys_heap_cache_disable(&heap->heap);
+			cache_disabled = true;
+			continue;
+		}
+#endif
+
 		timeout = sys_timepoint_timeout(end);
 		(void) z_pend_curr(&heap->lock, key, &heap->wait_q, timeout);
 		key = k_spin_lock(&heap->lock);
 	}
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+	if (cache_disabled) {
+		sys_heap_cache_enable(&heap->heap);
+	}
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, realloc, heap, ptr, bytes, timeout, ret);
 
 	k_spin_unlock(&heap->lock, key);
@@ -205,6 +251,13 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
+#ifdef CONFIG_SYS_HEAP_CACHE
+	if (sys_heap_cache_free(&heap->heap, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+		return;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	sys_heap_free(&heap->heap, mem);
@@ -18,6 +18,68 @@
 #include <ksched.h>
 #include <wait_q.h>
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+/* Number of blocks moved between a CPU cache and its slab at once */
+#define CPU_CACHE_BATCH (CONFIG_MEM_SLAB_CPU_CACHE_SIZE / 2)
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+/* Number of blocks handed out to users, slab->lock must be held */
+static uint32_t slab_num_used(struct k_mem_slab *slab)
+{
+	uint32_t num_used = slab->info.num_used;
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	/* blocks held in the CPU caches are free */
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		K_SPINLOCK(&slab->cpu_cache[i].lock) {
+			num_used -= slab->cpu_cache[i].num_free;
+		}
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+	return num_used;
+}
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+static uint32_t slab_max_used(struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	return (uint32_t)atomic_get(&slab->max_in_use);
+#else
+	return slab->info.max_used;
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+}
+
+/* slab->lock must be held */
+static void slab_max_used_reset(struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	atomic_set(&slab->max_in_use, atomic_get(&slab->num_in_use));
+#else
+	slab->info.max_used = slab->info.num_used;
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+}
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+
+/*
+ * With CPU caches the slab lock isn't taken for every block, so the
+ * utilization is tracked separately from info.num_used.
+ */
+static inline void slab_trace_used(struct k_mem_slab *slab, atomic_val_t delta)
+{
+#if defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION) && defined(CONFIG_MEM_SLAB_CPU_CACHE)
+	atomic_val_t used = atomic_add(&slab->num_in_use, delta) + delta;
+	atomic_val_t max = atomic_get(&slab->max_in_use);
+
+	while ((used > max) && !atomic_cas(&slab->max_in_use, max, used)) {
+		max = atomic_get(&slab->max_in_use);
+	}
+#else
+	ARG_UNUSED(slab);
+	ARG_UNUSED(delta);
+#endif
+}
+
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
 static struct k_obj_type obj_type_mem_slab;
 
@@ -33,6 +95,10 @@ static int k_mem_slab_stats_raw(struct k_obj_core *obj_core, void *stats)
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
 	memcpy(stats, &slab->info, sizeof(slab->info));
+	((struct k_mem_slab_info *)stats)->num_used = slab_num_used(slab);
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	((struct k_mem_slab_info *)stats)->max_used = slab_max_used(slab);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 	k_spin_unlock(&slab->lock, key);
 
 	return 0;
@@ -45,14 +111,16 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 	struct k_mem_slab *slab;
 	k_spinlock_key_t   key;
 	struct sys_memory_stats *ptr = stats;
+	uint32_t num_used;
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
-	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
+	num_used = slab_num_used(slab);
+	ptr->free_bytes = (slab->info.num_blocks - num_used) *
 			  slab->info.block_size;
-	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
+	ptr->allocated_bytes = num_used * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-	ptr->max_allocated_bytes = slab->info.max_used * slab->info.block_size;
+	ptr->max_allocated_bytes = slab_max_used(slab) * slab->info.block_size;
 #else
 	ptr->max_allocated_bytes = 0;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
@@ -72,7 +140,7 @@ static int k_mem_slab_stats_reset(struct k_obj_core *obj_core)
 	key = k_spin_lock(&slab->lock);
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-	slab->info.max_used = slab->info.num_used;
+	slab_max_used_reset(slab);
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
 	k_spin_unlock(&slab->lock, key);
@@ -184,6 +252,15 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->info.max_used = 0U;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	(void)memset(slab->cpu_cache, 0, sizeof(slab->cpu_cache));
+	atomic_clear(&slab->num_waiters);
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_clear(&slab->num_in_use);
+	atomic_clear(&slab->max_in_use);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	rc = create_free_list(slab);
 	if (rc < 0) {
 		goto out;
@@ -219,31 +296,195 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 	       ((offset % slab->info.block_size) == 0);
 }
 
+/* Take a block off the free list, slab->lock must be held */
+static void *slab_take(struct k_mem_slab *slab)
+{
+	char *mem = slab->free_list;
+
+	slab->free_list = *(char **)mem;
+	slab->info.num_used++;
+	__ASSERT((slab->free_list == NULL &&
+		  slab->info.num_used == slab->info.num_blocks) ||
+		 slab_ptr_is_good(slab, slab->free_list),
+		 "slab corruption detected");
+
+#if defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION) && !defined(CONFIG_MEM_SLAB_CPU_CACHE)
+	slab->info.max_used = MAX(slab->info.num_used,
+				  slab->info.max_used);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION && !CONFIG_MEM_SLAB_CPU_CACHE */
+
+	return mem;
+}
+
+/*
+ * Hand a block to the first waiting thread or put it back on the free
+ * list, slab->lock must be held. Returns true if a thread was readied.
+ */
+static bool slab_give(struct k_mem_slab *slab, void *mem)
+{
+	if (unlikely(slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
+		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+
+		if (unlikely(pending_thread != NULL)) {
+			z_thread_return_value_set_with_data(pending_thread, 0, mem);
+			z_ready_thread(pending_thread);
+			return true;
+		}
+	}
+	*(char **) mem = slab->free_list;
+	slab->free_list = (char *) mem;
+	slab->info.num_used--;
+
+	return false;
+}
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+/* Interrupts must be locked so that the caller can't migrate */
+static inline struct z_mem_slab_cpu_cache *cpu_cache_get(struct k_mem_slab *slab)
+{
+	return &slab->cpu_cache[_current_cpu->id];
+}
+
+/* Pop up to count blocks from the cache of the current CPU */
+static uint32_t cache_alloc(struct k_mem_slab *slab, void **mem, uint32_t count)
+{
+	unsigned int irq = arch_irq_lock();
+	struct z_mem_slab_cpu_cache *cache = cpu_cache_get(slab);
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	uint32_t n;
+
+	for (n = 0; (n < count) && (cache->free_list != NULL); n++) {
+		mem[n] = cache->free_list;
+		cache->free_list = *(char **)cache->free_list;
+		cache->num_free--;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq);
+
+	return n;
+}
+
+/* Push up to count blocks to the cache of the current CPU */
+static uint32_t cache_free(struct k_mem_slab *slab, void **mem, uint32_t count)
+{
+	unsigned int irq = arch_irq_lock();
+	struct z_mem_slab_cpu_cache *cache = cpu_cache_get(slab);
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	uint32_t n = 0;
+
+	/* waiting threads must get the blocks instead */
+	if (atomic_get(&slab->num_waiters) == 0) {
+		for (; (n < count) && (cache->num_free < CONFIG_MEM_SLAB_CPU_CACHE_SIZE); n++) {
+			*(char **)mem[n] = cache->free_list;
+			cache->free_list = mem[n];
+			cache->num_free++;
+		}
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq);
+
+	return n;
+}
+
+/* Move up to count blocks from the free list to a cache, both locks held */
+static void cache_refill(struct k_mem_slab *slab, struct z_mem_slab_cpu_cache *cache,
+			 uint32_t count)
+{
+	char *mem;
+
+	count = MIN(count, CONFIG_MEM_SLAB_CPU_CACHE_SIZE - cache->num_free);
+	while ((count-- > 0U) && (slab->free_list != NULL)) {
+		mem = slab_take(slab);
+		*(char **)mem = cache->free_list;
+		cache->free_list = mem;
+		cache->num_free++;
+	}
+}
+
+/* Give up to count blocks from a cache back to the slab, both locks held */
+static bool cache_flush(struct k_mem_slab *slab, struct z_mem_slab_cpu_cache *cache,
+			uint32_t count)
+{
+	bool need_resched = false;
+	char *mem;
+
+	while ((count-- > 0U) && (cache->free_list != NULL)) {
+		mem = cache->free_list;
+		cache->free_list = *(char **)mem;
+		cache->num_free--;
+		need_resched |= slab_give(slab, mem);
+	}
+
+	return need_resched;
+}
+
+/* Give the blocks of all CPU caches back to the slab, slab->lock held */
+static bool cache_reclaim(struct k_mem_slab *slab)
+{
+	bool need_resched = false;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		K_SPINLOCK(&slab->cpu_cache[i].lock) {
+			need_resched |= cache_flush(slab, &slab->cpu_cache[i], UINT32_MAX);
+		}
+	}
+
+	return need_resched;
+}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	bool wait = !K_TIMEOUT_EQ(timeout, K_NO_WAIT) && IS_ENABLED(CONFIG_MULTITHREADING);
+	bool need_resched = false;
+	k_spinlock_key_t key;
 	int result;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (cache_alloc(slab, mem, 1) == 1U) {
+		slab_trace_used(slab, 1);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+		return 0;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+	key = k_spin_lock(&slab->lock);
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (slab->free_list == NULL) {
+		/*
+		 * Announce the waiter before emptying the caches, so that
+		 * blocks freed afterwards bypass them.
+		 */
+		if (wait) {
+			atomic_inc(&slab->num_waiters);
+		}
+		need_resched = cache_reclaim(slab);
+		if (wait && (slab->free_list != NULL)) {
+			atomic_dec(&slab->num_waiters);
+		}
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	if (slab->free_list != NULL) {
 		/* take a free block */
-		*mem = slab->free_list;
-		slab->free_list = *(char **)(slab->free_list);
-		slab->info.num_used++;
-		__ASSERT((slab->free_list == NULL &&
-			  slab->info.num_used == slab->info.num_blocks) ||
-			 slab_ptr_is_good(slab, slab->free_list),
-			 "slab corruption detected");
-
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-		slab->info.max_used = MAX(slab->info.num_used,
-					  slab->info.max_used);
-#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+		*mem = slab_take(slab);
+		slab_trace_used(slab, 1);
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+		if (atomic_get(&slab->num_waiters) == 0) {
+			K_SPINLOCK(&cpu_cache_get(slab)->lock) {
+				cache_refill(slab, cpu_cache_get(slab), CPU_CACHE_BATCH);
+			}
+		}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
 
 		result = 0;
-	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
-		   !IS_ENABLED(CONFIG_MULTITHREADING)) {
+	} else if (!wait) {
 		/* don't wait for a free block to become available */
 		*mem = NULL;
 		result = -ENOMEM;
@@ -254,8 +495,13 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 		result = z_pend_curr(&slab->lock, key, &slab->wait_q, timeout);
 		if (result == 0) {
 			*mem = _current->base.swap_data;
+			slab_trace_used(slab, 1);
 		}
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+		atomic_dec(&slab->num_waiters);
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 		return result;
@@ -263,42 +509,145 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
-	k_spin_unlock(&slab->lock, key);
+	if (need_resched) {
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
 
 	return result;
 }
 
+int k_mem_slab_alloc_bulk(struct k_mem_slab *slab, void **mem, uint32_t count,
+			  k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	uint32_t n = 0;
+	int result;
+
+	CHECKIF((mem == NULL) || (count == 0U)) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	n = cache_alloc(slab, mem, count);
+	if (n == count) {
+		slab_trace_used(slab, n);
+		return n;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+	key = k_spin_lock(&slab->lock);
+
+	while ((n < count) && (slab->free_list != NULL)) {
+		mem[n++] = slab_take(slab);
+	}
+
+	k_spin_unlock(&slab->lock, key);
+
+	if (n != 0U) {
+		slab_trace_used(slab, n);
+		return n;
+	}
+
+	/* no block at hand: reclaim the CPU caches or wait for a block */
+	result = k_mem_slab_alloc(slab, &mem[0], timeout);
+
+	return (result == 0) ? 1 : result;
+}
+
 void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 {
+	k_spinlock_key_t key;
+	bool need_resched;
+
 	if (!slab_ptr_is_good(slab, mem)) {
 		__ASSERT(false, "Invalid memory pointer provided");
 		k_panic();
 		return;
 	}
 
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
-
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
-	if (unlikely(slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
-		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
 
-		if (unlikely(pending_thread != NULL)) {
-			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+	slab_trace_used(slab, -1);
 
-			z_thread_return_value_set_with_data(pending_thread, 0, mem);
-			z_ready_thread(pending_thread);
-			z_reschedule(&slab->lock, key);
-			return;
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (cache_free(slab, &mem, 1) == 1U) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+		return;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+	key = k_spin_lock(&slab->lock);
+
+	need_resched = slab_give(slab, mem);
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	/* make room in a full cache for the next blocks freed on this CPU */
+	K_SPINLOCK(&cpu_cache_get(slab)->lock) {
+		if (cpu_cache_get(slab)->num_free == CONFIG_MEM_SLAB_CPU_CACHE_SIZE) {
+			need_resched |= cache_flush(slab, cpu_cache_get(slab), CPU_CACHE_BATCH);
 		}
 	}
-	*(char **) mem = slab->free_list;
-	slab->free_list = (char *) mem;
-	slab->info.num_used--;
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
-	k_spin_unlock(&slab->lock, key);
+	if (need_resched) {
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
+}
+
+void k_mem_slab_free_bulk(struct k_mem_slab *slab, void **mem, uint32_t count)
+{
+	k_spinlock_key_t key;
+	bool need_resched = false;
+	uint32_t n = 0;
+
+	for (uint32_t i = 0; i < count; i++) {
+		if (!slab_ptr_is_good(slab, mem[i])) {
+			__ASSERT(false, "Invalid memory pointer provided");
+			k_panic();
+			return;
+		}
+	}
+
+	slab_trace_used(slab, -(atomic_val_t)count);
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	n = cache_free(slab, mem, count);
+	if (n == count) {
+		return;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+	key = k_spin_lock(&slab->lock);
+
+	while (n < count) {
+		need_resched |= slab_give(slab, mem[n++]);
+	}
+
+	if (need_resched) {
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
+}
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+uint32_t z_mem_slab_num_used_get(struct k_mem_slab *slab)
+{
+	uint32_t num_used;
+
+	K_SPINLOCK(&slab->lock) {
+		num_used = slab_num_used(slab);
+	}
+
+	return num_used;
 }
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
 
 int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stats *stats)
 {
@@ -307,12 +656,13 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 	}
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	uint32_t num_used = slab_num_used(slab);
 
-	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
-	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
+	stats->allocated_bytes = num_used * slab->info.block_size;
+	stats->free_bytes = (slab->info.num_blocks - num_used) *
 			    slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-	stats->max_allocated_bytes = slab->info.max_used *
+	stats->max_allocated_bytes = slab_max_used(slab) *
 				     slab->info.block_size;
 #else
 	stats->max_allocated_bytes = 0;
@@ -332,7 +682,7 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	slab->info.max_used = slab->info.num_used;
+	slab_max_used_reset(slab);
 
 	k_spin_unlock(&slab->lock, key);
 
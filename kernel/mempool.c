@@ -38,9 +38,16 @@ static void *z_alloc_helper(struct k_heap *heap, size_t align, size_t size,
 	 * No point calling k_heap_malloc/k_heap_aligned_alloc with K_NO_WAIT.
 	 * Better bypass them and go directly to sys_heap_*() instead.
 	 */
-	key = k_spin_lock(&heap->lock);
-	mem = sys_heap_allocator(&heap->heap, __align, size);
-	k_spin_unlock(&heap->lock, key);
+#ifdef CONFIG_SYS_HEAP_CACHE
+	/* without alignment, sys_heap_*() ends up in sys_heap_alloc() */
+	mem = (align == 0U) ? sys_heap_cache_alloc(&heap->heap, size) : NULL;
+	if (mem == NULL)
+#endif
+	{
+		key = k_spin_lock(&heap->lock);
+		mem = sys_heap_allocator(&heap->heap, __align, size);
+		k_spin_unlock(&heap->lock, key);
+	}
 
 	if (mem == NULL) {
 		return NULL;
@@ -1577,6 +1577,46 @@ static inline void paging_stats_eviction_inc(struct k_thread *faulting_thread,
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 }
 
+static inline void paging_stats_fault_time_add(struct k_thread *faulting_thread,
+					       uint32_t cycles)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.pagefaults.cycles += cycles;
+	if (cycles > paging_stats.pagefaults.longest_cycles) {
+		paging_stats.pagefaults.longest_cycles = cycles;
+	}
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	faulting_thread->paging_stats.pagefaults.cycles += cycles;
+	if (cycles > faulting_thread->paging_stats.pagefaults.longest_cycles) {
+		faulting_thread->paging_stats.pagefaults.longest_cycles = cycles;
+	}
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#else
+	ARG_UNUSED(faulting_thread);
+	ARG_UNUSED(cycles);
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
+static inline void paging_stats_read_ahead_inc(struct k_thread *faulting_thread,
+					       unsigned int pages)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.read_ahead.sequential++;
+	paging_stats.read_ahead.pages += pages;
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	faulting_thread->paging_stats.read_ahead.sequential++;
+	faulting_thread->paging_stats.read_ahead.pages += pages;
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#else
+	ARG_UNUSED(faulting_thread);
+	ARG_UNUSED(pages);
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
 static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 {
 	struct k_mem_page_frame *pf;
@@ -1611,6 +1651,169 @@ static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
+#if CONFIG_DEMAND_PAGING_READ_AHEAD > 0
+/* Data page which would make the next page fault sequential */
+static uint8_t *read_ahead_next;
+
+/*
+ * Page in the data pages following the one at addr, as long as they are
+ * paged out and free page frames are left. Returns the number of data
+ * pages paged in.
+ */
+static unsigned int do_read_ahead_locked(uint8_t *addr, k_spinlock_key_t *key)
+{
+	unsigned int count;
+
+	for (count = 0U; count < CONFIG_DEMAND_PAGING_READ_AHEAD; count++) {
+		uint8_t *pos = addr + ((count + 1U) * CONFIG_MMU_PAGE_SIZE);
+		struct k_mem_page_frame *pf;
+		uintptr_t location, unused;
+		bool dirty = false;
+		int ret;
+
+		if (pos >= K_MEM_VIRT_RAM_END) {
+			break;
+		}
+		if (arch_page_location_get(pos, &location) !=
+		    ARCH_PAGE_LOCATION_PAGED_OUT) {
+			break;
+		}
+#ifdef CONFIG_DEMAND_MAPPING
+		if ((location == ARCH_UNPAGED_ANON_ZERO) ||
+		    (location == ARCH_UNPAGED_ANON_UNINIT)) {
+			/* Nothing to read from the backing store */
+			break;
+		}
+#endif /* CONFIG_DEMAND_MAPPING */
+
+		/* Never evict anything to make room for these */
+		pf = free_page_frame_list_get();
+		if (pf == NULL) {
+			break;
+		}
+		ret = page_frame_prepare_locked(pf, &dirty, true, &unused);
+		__ASSERT(ret == 0, "failed to prepare page frame");
+		(void)ret;
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		k_spin_unlock(&z_mm_lock, *key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		do_backing_store_page_in(location);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		*key = k_spin_lock(&z_mm_lock);
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_BUSY);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		frame_mapped_set(pf, pos);
+		arch_mem_page_in(pos, k_mem_page_frame_to_phys(pf));
+		k_mem_paging_backing_store_page_finalize(pf, location);
+		if (IS_ENABLED(CONFIG_EVICTION_TRACKING)) {
+			k_mem_paging_eviction_add(pf);
+		}
+	}
+
+	return count;
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD > 0 */
+
+#ifdef CONFIG_DEMAND_PAGING_BACKGROUND_EVICTION
+BUILD_ASSERT(CONFIG_DEMAND_PAGING_FREE_HIGH >= CONFIG_DEMAND_PAGING_FREE_LOW,
+	     "free page frames high watermark below the low one");
+
+static K_KERNEL_PINNED_STACK_DEFINE(paging_evict_stack,
+				    CONFIG_DEMAND_PAGING_EVICTION_THREAD_STACK_SIZE);
+__pinned_bss
+static struct k_thread paging_evict_thread;
+static K_SEM_DEFINE(paging_evict_sem, 0, 1);
+
+/* Evict one data page, returns false if there is nothing left to do */
+static bool do_background_evict(void)
+{
+	struct k_mem_page_frame *pf;
+	k_spinlock_key_t key;
+	uintptr_t location;
+	bool dirty;
+	bool result = false;
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+#ifdef CONFIG_SMP
+	k_mutex_lock(&z_mm_paging_lock, K_FOREVER);
+#else
+	k_sched_lock();
+#endif
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	key = k_spin_lock(&z_mm_lock);
+	if (z_free_page_count >= CONFIG_DEMAND_PAGING_FREE_HIGH) {
+		goto out;
+	}
+
+	pf = do_eviction_select(&dirty);
+	if (pf == NULL) {
+		goto out;
+	}
+	if (page_frame_prepare_locked(pf, &dirty, false, &location) != 0) {
+		goto out;
+	}
+
+	paging_stats_eviction_inc(_current, dirty);
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.eviction.background++;
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_spin_unlock(&z_mm_lock, key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	if (dirty) {
+		do_backing_store_page_out(location);
+	}
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	key = k_spin_lock(&z_mm_lock);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	page_frame_free_locked(pf);
+	result = true;
+out:
+	k_spin_unlock(&z_mm_lock, key);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+#ifdef CONFIG_SMP
+	k_mutex_unlock(&z_mm_paging_lock);
+#else
+	k_sched_unlock();
+#endif
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+
+	return result;
+}
+
+static void paging_evict_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_sem_take(&paging_evict_sem, K_FOREVER);
+
+		/* Each data page is evicted on its own, so that page faults
+		 * do not wait for the whole batch
+		 */
+		while (do_background_evict()) {
+		}
+	}
+}
+
+static int paging_evict_init(void)
+{
+	k_thread_create(&paging_evict_thread, paging_evict_stack,
+			K_KERNEL_STACK_SIZEOF(paging_evict_stack),
+			paging_evict_entry, NULL, NULL, NULL,
+			K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_NO_WAIT);
+	k_thread_name_set(&paging_evict_thread, "paging_evict");
+
+	return 0;
+}
+
+SYS_INIT(paging_evict_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_DEMAND_PAGING_BACKGROUND_EVICTION */
+
 static bool do_page_fault(void *addr, bool pin)
 {
 	struct k_mem_page_frame *pf;
@@ -1621,6 +1824,12 @@ static bool do_page_fault(void *addr, bool pin)
 	bool dirty = false;
 	struct k_thread *faulting_thread;
 	int ret;
+#ifdef CONFIG_DEMAND_PAGING_BACKGROUND_EVICTION
+	bool evict = false;
+#endif /* CONFIG_DEMAND_PAGING_BACKGROUND_EVICTION */
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	uint32_t time_start = k_cycle_get_32();
+#endif /* CONFIG_DEMAND_PAGING_STATS */
 
 	__ASSERT(page_frames_initialized, "page fault at %p happened too early",
 		 addr);
@@ -1752,6 +1961,28 @@ static bool do_page_fault(void *addr, bool pin)
 	if (IS_ENABLED(CONFIG_EVICTION_TRACKING) && (!pin)) {
 		k_mem_paging_eviction_add(pf);
 	}
+
+#if CONFIG_DEMAND_PAGING_READ_AHEAD > 0
+	if (!pin) {
+		uint8_t *page = UINT_TO_POINTER(ROUND_DOWN(POINTER_TO_UINT(addr),
+							   CONFIG_MMU_PAGE_SIZE));
+		unsigned int count = 0U;
+
+		if (page == read_ahead_next) {
+			count = do_read_ahead_locked(page, &key);
+			paging_stats_read_ahead_inc(faulting_thread, count);
+		}
+		read_ahead_next = page + ((count + 1U) * CONFIG_MMU_PAGE_SIZE);
+	}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD > 0 */
+
+#ifdef CONFIG_DEMAND_PAGING_BACKGROUND_EVICTION
+	evict = (z_free_page_count < CONFIG_DEMAND_PAGING_FREE_LOW);
+#endif /* CONFIG_DEMAND_PAGING_BACKGROUND_EVICTION */
+
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats_fault_time_add(faulting_thread, k_cycle_get_32() - time_start);
+#endif /* CONFIG_DEMAND_PAGING_STATS */
 out:
 	k_spin_unlock(&z_mm_lock, key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
@@ -1762,6 +1993,12 @@ out:
 #endif
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
 
+#ifdef CONFIG_DEMAND_PAGING_BACKGROUND_EVICTION
+	if (evict) {
+		k_sem_give(&paging_evict_sem);
+	}
+#endif /* CONFIG_DEMAND_PAGING_BACKGROUND_EVICTION */
+
 	return result;
 }
 
@@ -40,6 +40,298 @@ static inline bool handle_poll_events(struct k_msgq *msgq)
 #endif /* CONFIG_POLL */
 }
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+/*
+ * Lock-free ring
+ *
+ * Queues with slot sequence numbers keep their messages in a bounded
+ * multi-producer/multi-consumer ring.  Ring positions advance modulo
+ * max_msgs * laps: the slot of a position is pos % max_msgs and its lap
+ * is pos / max_msgs.  The sequence number of a slot is 2 * lap while the
+ * slot is free for the message of that lap, and 2 * lap + 1 once that
+ * message has been written.  Reading the message frees the slot for the
+ * next lap, so sequence numbers advance modulo 2 * laps, and an all-zero
+ * array describes an empty ring.
+ *
+ * A writer claims a position by advancing write_pos with a CAS once the
+ * slot is seen free, copies the message, and then publishes it through
+ * the sequence number.  Readers do the same with read_pos.
+ *
+ * The message queue lock is only taken to pend and wake threads.  A
+ * thread about to pend increments waiters under the lock and retries
+ * the ring before pending, while a thread that changed the ring checks
+ * waiters afterwards and, if needed, wakes up a waiter, which retries.
+ */
+
+static inline uint32_t ring_wrap(const struct k_msgq *msgq)
+{
+	return msgq->max_msgs * msgq->laps;
+}
+
+/* Signed distance from b to a, both being modulo wrap */
+static inline int32_t ring_diff(uint32_t a, uint32_t b, uint32_t wrap)
+{
+	int32_t diff = (int32_t)(a - b);
+
+	if (diff > (int32_t)(wrap / 2U)) {
+		diff -= (int32_t)wrap;
+	} else if (diff < -(int32_t)(wrap / 2U)) {
+		diff += (int32_t)wrap;
+	}
+
+	return diff;
+}
+
+static inline uint32_t ring_advance(uint32_t pos, uint32_t n, uint32_t wrap)
+{
+	pos += n;
+
+	return (pos >= wrap) ? (pos - wrap) : pos;
+}
+
+/* Only K_MSGQ_LOCKFREE_DEFINE() has room for the slot sequence numbers */
+static void ring_init(struct k_msgq *msgq)
+{
+	msgq->slot_seq = NULL;
+	(void)atomic_clear(&msgq->write_pos);
+	(void)atomic_clear(&msgq->read_pos);
+	(void)atomic_clear(&msgq->waiters);
+	msgq->laps = Z_MSGQ_LOCKFREE_POS_MAX / MAX(msgq->max_msgs, 1U);
+	z_waitq_init(&msgq->send_wait_q);
+}
+
+static bool ring_put(struct k_msgq *msgq, const void *data)
+{
+	uint32_t wrap = ring_wrap(msgq);
+	uint32_t pos = (uint32_t)atomic_get(&msgq->write_pos);
+	uint32_t slot;
+	uint32_t lap;
+	int32_t diff;
+
+	for (;;) {
+		slot = pos % msgq->max_msgs;
+		lap = pos / msgq->max_msgs;
+		diff = ring_diff((uint32_t)atomic_get(&msgq->slot_seq[slot]), 2U * lap,
+				 2U * msgq->laps);
+
+		if (diff == 0) {
+			if (atomic_cas(&msgq->write_pos, (atomic_val_t)pos,
+				       (atomic_val_t)ring_advance(pos, 1U, wrap))) {
+				break;
+			}
+		} else if (diff < 0) {
+			/* slot still holds the message of the previous lap */
+			return false;
+		} else {
+			/* another writer got there first */
+		}
+
+		pos = (uint32_t)atomic_get(&msgq->write_pos);
+	}
+
+	(void)memcpy(msgq->buffer_start + (slot * msgq->msg_size), data, msgq->msg_size);
+	(void)atomic_set(&msgq->slot_seq[slot], (atomic_val_t)(2U * lap + 1U));
+
+	return true;
+}
+
+/* Take the oldest message out of the ring, discarding it if data is NULL */
+static bool ring_get(struct k_msgq *msgq, void *data)
+{
+	uint32_t wrap = ring_wrap(msgq);
+	uint32_t pos = (uint32_t)atomic_get(&msgq->read_pos);
+	uint32_t slot;
+	uint32_t lap;
+	int32_t diff;
+
+	for (;;) {
+		slot = pos % msgq->max_msgs;
+		lap = pos / msgq->max_msgs;
+		diff = ring_diff((uint32_t)atomic_get(&msgq->slot_seq[slot]), 2U * lap + 1U,
+				 2U * msgq->laps);
+
+		if (diff == 0) {
+			if (atomic_cas(&msgq->read_pos, (atomic_val_t)pos,
+				       (atomic_val_t)ring_advance(pos, 1U, wrap))) {
+				break;
+			}
+		} else if (diff < 0) {
+			/* message of this lap not written yet */
+			return false;
+		} else {
+			/* another reader got there first */
+		}
+
+		pos = (uint32_t)atomic_get(&msgq->read_pos);
+	}
+
+	if (data != NULL) {
+		(void)memcpy(data, msgq->buffer_start + (slot * msgq->msg_size),
+			     msgq->msg_size);
+	}
+	(void)atomic_set(&msgq->slot_seq[slot],
+			 (atomic_val_t)ring_advance(2U * lap + 1U, 1U, 2U * msgq->laps));
+
+	return true;
+}
+
+/* Copy the message at index idx without taking it out of the ring */
+static int ring_peek(struct k_msgq *msgq, void *data, uint32_t idx)
+{
+	uint32_t wrap = ring_wrap(msgq);
+	uint32_t pos;
+	uint32_t slot_pos;
+	uint32_t slot;
+
+	if (idx >= msgq->max_msgs) {
+		return -ENOMSG;
+	}
+
+	for (;;) {
+		pos = (uint32_t)atomic_get(&msgq->read_pos);
+		slot_pos = ring_advance(pos, idx, wrap);
+		slot = slot_pos % msgq->max_msgs;
+
+		if ((uint32_t)atomic_get(&msgq->slot_seq[slot]) !=
+		    2U * (slot_pos / msgq->max_msgs) + 1U) {
+			if ((uint32_t)atomic_get(&msgq->read_pos) == pos) {
+				return -ENOMSG;
+			}
+			continue;
+		}
+
+		(void)memcpy(data, msgq->buffer_start + (slot * msgq->msg_size),
+			     msgq->msg_size);
+
+		/* the copy is valid if no reader claimed a message meanwhile */
+		if ((uint32_t)atomic_get(&msgq->read_pos) == pos) {
+			return 0;
+		}
+	}
+}
+
+uint32_t z_msgq_lockfree_used(struct k_msgq *msgq)
+{
+	int32_t used = ring_diff((uint32_t)atomic_get(&msgq->write_pos),
+				 (uint32_t)atomic_get(&msgq->read_pos), ring_wrap(msgq));
+
+	return (uint32_t)CLAMP(used, 0, (int32_t)msgq->max_msgs);
+}
+
+/* Wake up one thread of wait_q, if any thread may be pending */
+static void ring_wake(struct k_msgq *msgq, _wait_q_t *wait_q, bool resched)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+
+	if (atomic_get(&msgq->waiters) != 0) {
+		key = k_spin_lock(&msgq->lock);
+
+		pending_thread = z_unpend_first_thread(wait_q);
+		if (pending_thread != NULL) {
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			z_reschedule(&msgq->lock, key);
+			return;
+		}
+
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	if (resched) {
+		z_reschedule_unlocked();
+	}
+}
+
+static int ring_put_wait(struct k_msgq *msgq, const void *data, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int result = -ENOMSG;
+
+	while (!ring_put(msgq, data)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return result;
+		}
+
+		key = k_spin_lock(&msgq->lock);
+
+		(void)atomic_inc(&msgq->waiters);
+		if (ring_put(msgq, data)) {
+			(void)atomic_dec(&msgq->waiters);
+			k_spin_unlock(&msgq->lock, key);
+			break;
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put, msgq, timeout);
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->send_wait_q, timeout);
+		(void)atomic_dec(&msgq->waiters);
+		if (result != 0) {
+			return result;
+		}
+
+		/* woken up to retry: running out of time is now a timeout */
+		result = -EAGAIN;
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	ring_wake(msgq, &msgq->wait_q, handle_poll_events(msgq));
+
+	return 0;
+}
+
+static int ring_get_wait(struct k_msgq *msgq, void *data, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int result = -ENOMSG;
+
+	while (!ring_get(msgq, data)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return result;
+		}
+
+		key = k_spin_lock(&msgq->lock);
+
+		(void)atomic_inc(&msgq->waiters);
+		if (ring_get(msgq, data)) {
+			(void)atomic_dec(&msgq->waiters);
+			k_spin_unlock(&msgq->lock, key);
+			break;
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		(void)atomic_dec(&msgq->waiters);
+		if (result != 0) {
+			return result;
+		}
+
+		/* woken up to retry: running out of time is now a timeout */
+		result = -EAGAIN;
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	ring_wake(msgq, &msgq->send_wait_q, false);
+
+	return 0;
+}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
+/* Threads waiting for space in the queue */
+static inline _wait_q_t *send_wait_q(struct k_msgq *msgq)
+{
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq->slot_seq != NULL) {
+		return &msgq->send_wait_q;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
+	return &msgq->wait_q;
+}
+
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs)
 {
@@ -53,6 +345,9 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	msgq->flags = 0;
 	z_waitq_init(&msgq->wait_q);
 	msgq->lock = (struct k_spinlock) {};
+#ifdef CONFIG_MSGQ_LOCKFREE
+	ring_init(msgq);
+#endif /* CONFIG_MSGQ_LOCKFREE */
 #ifdef CONFIG_POLL
 	sys_dlist_init(&msgq->poll_events);
 #endif	/* CONFIG_POLL */
@@ -108,7 +403,8 @@ int k_msgq_cleanup(struct k_msgq *msgq)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, cleanup, msgq);
 
-	CHECKIF(z_waitq_head(&msgq->wait_q) != NULL) {
+	CHECKIF((z_waitq_head(&msgq->wait_q) != NULL) ||
+		(z_waitq_head(send_wait_q(msgq)) != NULL)) {
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, cleanup, msgq, -EBUSY);
 
 		return -EBUSY;
@@ -134,6 +430,18 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 	int result;
 	bool resched = false;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq->slot_seq != NULL) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
+
+		result = ring_put_wait(msgq, data, timeout);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	key = k_spin_lock(&msgq->lock);
 
 	if (put_at_back) {
@@ -230,6 +538,13 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 
 int z_impl_k_msgq_put_front(struct k_msgq *msgq, const void *data)
 {
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq->slot_seq != NULL) {
+		/* the ring can only be written at its back */
+		return -ENOTSUP;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	return put_msg_in_queue(msgq, data, K_NO_WAIT, false);
 }
 
@@ -258,7 +573,7 @@ void z_impl_k_msgq_get_attrs(struct k_msgq *msgq, struct k_msgq_attrs *attrs)
 {
 	attrs->msg_size = msgq->msg_size;
 	attrs->max_msgs = msgq->max_msgs;
-	attrs->used_msgs = msgq->used_msgs;
+	attrs->used_msgs = z_impl_k_msgq_num_used_get(msgq);
 }
 
 #ifdef CONFIG_USERSPACE
@@ -281,6 +596,18 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	int result;
 	bool resched = false;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq->slot_seq != NULL) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
+
+		result = ring_get_wait(msgq, data, timeout);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
@@ -358,6 +685,16 @@ int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 	k_spinlock_key_t key;
 	int result;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq->slot_seq != NULL) {
+		result = ring_peek(msgq, data, 0U);
+
+		SYS_PORT_TRACING_OBJ_FUNC(k_msgq, peek, msgq, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	key = k_spin_lock(&msgq->lock);
 
 	if (msgq->used_msgs > 0U) {
@@ -395,6 +732,16 @@ int z_impl_k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx)
 	uint32_t byte_offset;
 	char *start_addr;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq->slot_seq != NULL) {
+		result = ring_peek(msgq, data, idx);
+
+		SYS_PORT_TRACING_OBJ_FUNC(k_msgq, peek, msgq, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	key = k_spin_lock(&msgq->lock);
 
 	if (msgq->used_msgs > idx) {
@@ -444,14 +791,24 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 	SYS_PORT_TRACING_OBJ_FUNC(k_msgq, purge, msgq);
 
 	/* wake up any threads that are waiting to write */
-	for (pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	for (pending_thread = z_unpend_first_thread(send_wait_q(msgq));
 	     pending_thread != NULL;
-	     pending_thread = z_unpend_first_thread(&msgq->wait_q)) {
+	     pending_thread = z_unpend_first_thread(send_wait_q(msgq))) {
 		arch_thread_return_value_set(pending_thread, -ENOMSG);
 		z_ready_thread(pending_thread);
 		resched = true;
 	}
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq->slot_seq != NULL) {
+		for (uint32_t i = 0U; i < msgq->max_msgs; i++) {
+			if (!ring_get(msgq, NULL)) {
+				break;
+			}
+		}
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	msgq->used_msgs = 0;
 	msgq->read_ptr = msgq->write_ptr;
 
@@ -39,6 +39,9 @@
 #include <zephyr/sys/check.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/llext/symbol.h>
+#include <zephyr/sys/mutex.h>
+#include <kernel_internal.h>
+#include <string.h>
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 
 /* We use a global spinlock here because some of the synchronization
@@ -50,6 +53,49 @@ static struct k_spinlock lock;
 
 #ifdef CONFIG_OBJ_CORE_MUTEX
 static struct k_obj_type obj_type_mutex;
+
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+static int k_mutex_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_mutex *mutex;
+	k_spinlock_key_t key;
+
+	mutex = CONTAINER_OF(obj_core, struct k_mutex, obj_core);
+	key = k_spin_lock(&lock);
+	memcpy(stats, &mutex->stats, sizeof(mutex->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static int k_mutex_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_mutex *mutex;
+	k_spinlock_key_t key;
+
+	mutex = CONTAINER_OF(obj_core, struct k_mutex, obj_core);
+	key = k_spin_lock(&lock);
+	mutex->stats.spins = 0U;
+	mutex->stats.acquired = 0U;
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc mutex_stats_desc = {
+	.raw_size = sizeof(struct k_adaptive_spin_stats),
+	.query_size = sizeof(struct k_adaptive_spin_stats),
+	.raw   = k_mutex_stats_raw,
+	.query = k_mutex_stats_raw,
+	.reset = k_mutex_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 #endif /* CONFIG_OBJ_CORE_MUTEX */
 
 int z_impl_k_mutex_init(struct k_mutex *mutex)
@@ -63,6 +109,12 @@ int z_impl_k_mutex_init(struct k_mutex *mutex)
 
 #ifdef CONFIG_OBJ_CORE_MUTEX
 	k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	mutex->stats.spins = 0U;
+	mutex->stats.acquired = 0U;
+	k_obj_core_stats_register(K_OBJ_CORE(mutex), &mutex->stats,
+				  sizeof(struct k_adaptive_spin_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 #endif /* CONFIG_OBJ_CORE_MUTEX */
 
 	SYS_PORT_TRACING_OBJ_INIT(k_mutex, mutex, 0);
@@ -102,6 +154,58 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+static bool mutex_spin_worthwhile(struct k_mutex *mutex)
+{
+	struct k_thread *owner = mutex->owner;
+
+	/* Releases go to pending threads first, and an owner that is not
+	 * running will not release the mutex any time soon.
+	 */
+	return (z_waitq_head(&mutex->wait_q) == NULL) && (owner != NULL) &&
+	       z_is_thread_running_elsewhere(owner);
+}
+
+/*
+ * Busy wait for a contended mutex while its owner runs on another CPU.
+ * Called and returns with the lock held, which is released while
+ * spinning.  Returns true if the mutex became free, in which case the
+ * caller takes it.
+ */
+static bool mutex_spin(struct k_mutex *mutex, k_spinlock_key_t *key)
+{
+	uint32_t start = k_cycle_get_32();
+
+	if (!mutex_spin_worthwhile(mutex)) {
+		return false;
+	}
+
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	mutex->stats.spins++;
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+
+	do {
+		k_spin_unlock(&lock, *key);
+
+		do {
+			z_adaptive_spin_relax();
+		} while ((*(volatile uint32_t *)&mutex->lock_count != 0U) &&
+			 z_adaptive_spin_time_left(start));
+
+		*key = k_spin_lock(&lock);
+
+		if (mutex->lock_count == 0U) {
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+			mutex->stats.acquired++;
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+			return true;
+		}
+	} while (mutex_spin_worthwhile(mutex) && z_adaptive_spin_time_left(start));
+
+	return false;
+}
+#endif /* CONFIG_ADAPTIVE_SPIN */
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
@@ -114,6 +218,13 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+	if ((mutex->lock_count != 0U) && (mutex->owner != _current) &&
+	    !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		(void)mutex_spin(mutex, &key);
+	}
+#endif /* CONFIG_ADAPTIVE_SPIN */
+
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
@@ -290,6 +401,141 @@ static inline int z_vrfy_k_mutex_unlock(struct k_mutex *mutex)
 	return z_impl_k_mutex_unlock(mutex);
 }
 #include <zephyr/syscalls/k_mutex_unlock_mrsh.c>
+
+/*
+ * Slow paths of sys_mutex.  The sys_mutex value in user memory holds the
+ * owner, and the kernel mutex only tracks it while threads wait, for
+ * priority inheritance.  The value may be changed by user threads at any
+ * time, so the kernel mutex never trusts it beyond its validated owner.
+ */
+int z_mutex_user_lock(struct k_mutex *mutex, atomic_t *val, atomic_val_t old,
+		      k_timeout_t timeout)
+{
+	struct k_thread *waiter;
+	k_spinlock_key_t key;
+	bool resched = false;
+	int new_prio;
+	int ret;
+
+	key = k_spin_lock(&lock);
+
+	if (old == 0) {
+		ret = atomic_cas(val, 0, (atomic_val_t)_current) ? 0 : 1;
+		k_spin_unlock(&lock, key);
+
+		return ret;
+	}
+
+	/* Validated by the caller, but it may have exited since, and must
+	 * not be left as the owner of the kernel mutex
+	 */
+	if (z_is_thread_state_set((struct k_thread *)(old & ~SYS_MUTEX_WAITERS),
+				  _THREAD_DEAD)) {
+		k_spin_unlock(&lock, key);
+
+		return -EINVAL;
+	}
+
+	if (!atomic_cas(val, old, old | SYS_MUTEX_WAITERS)) {
+		k_spin_unlock(&lock, key);
+
+		return 1;
+	}
+
+	if (mutex->owner == NULL) {
+		/* First waiter, the owner locked the mutex in user mode */
+		mutex->owner = (struct k_thread *)(old & ~SYS_MUTEX_WAITERS);
+		mutex->owner_orig_prio = mutex->owner->base.prio;
+		mutex->lock_count = 1U;
+	}
+
+	new_prio = new_prio_for_inheritance(_current->base.prio,
+					    mutex->owner->base.prio);
+	if (z_is_prio_higher(new_prio, mutex->owner->base.prio)) {
+		resched = adjust_owner_prio(mutex, new_prio);
+	}
+
+	ret = z_pend_curr(&lock, key, &mutex->wait_q, timeout);
+	if (ret == 0) {
+		/* The owner handed the mutex over */
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+
+	if (likely(mutex->owner != NULL)) {
+		waiter = z_waitq_head(&mutex->wait_q);
+
+		new_prio = (waiter != NULL) ?
+			new_prio_for_inheritance(waiter->base.prio, mutex->owner_orig_prio) :
+			mutex->owner_orig_prio;
+
+		resched = adjust_owner_prio(mutex, new_prio) || resched;
+
+		if (waiter == NULL) {
+			/* The owner can unlock in user mode again */
+			(void)atomic_and(val, ~SYS_MUTEX_WAITERS);
+			mutex->owner = NULL;
+			mutex->lock_count = 0U;
+		}
+	}
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return -EAGAIN;
+}
+
+int z_mutex_user_unlock(struct k_mutex *mutex, atomic_t *val)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	atomic_val_t old = atomic_get(val);
+	struct k_thread *new_owner;
+
+	if ((old & ~SYS_MUTEX_WAITERS) != (atomic_val_t)_current) {
+		k_spin_unlock(&lock, key);
+
+		return (old == 0) ? -EINVAL : -EPERM;
+	}
+
+	if (mutex->owner == NULL) {
+		(void)atomic_set(val, 0);
+		k_spin_unlock(&lock, key);
+
+		return 0;
+	}
+
+	adjust_owner_prio(mutex, mutex->owner_orig_prio);
+
+	new_owner = z_unpend_first_thread(&mutex->wait_q);
+	if (new_owner == NULL) {
+		(void)atomic_set(val, 0);
+		mutex->owner = NULL;
+		mutex->lock_count = 0U;
+		k_spin_unlock(&lock, key);
+
+		return 0;
+	}
+
+	if (z_waitq_head(&mutex->wait_q) != NULL) {
+		(void)atomic_set(val, (atomic_val_t)new_owner | SYS_MUTEX_WAITERS);
+		mutex->owner = new_owner;
+		mutex->owner_orig_prio = new_owner->base.prio;
+	} else {
+		(void)atomic_set(val, (atomic_val_t)new_owner);
+		mutex->owner = NULL;
+		mutex->lock_count = 0U;
+	}
+
+	arch_thread_return_value_set(new_owner, 0);
+	z_ready_thread(new_owner);
+	z_reschedule(&lock, key);
+
+	return 0;
+}
 #endif /* CONFIG_USERSPACE */
 
 #ifdef CONFIG_OBJ_CORE_MUTEX
@@ -299,11 +545,18 @@ static int init_mutex_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_mutex, K_OBJ_TYPE_MUTEX_ID,
 			offsetof(struct k_mutex, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	k_obj_type_stats_init(&obj_type_mutex, &mutex_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 
 	/* Initialize and link statically defined mutexes */
 
 	STRUCT_SECTION_FOREACH(k_mutex, mutex) {
 		k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+		k_obj_core_stats_register(K_OBJ_CORE(mutex), &mutex->stats,
+					  sizeof(struct k_adaptive_spin_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 	}
 
 	return 0;
@@ -24,6 +24,16 @@ static inline bool pipe_resetting(struct k_pipe *pipe)
 	return (pipe->flags & PIPE_FLAG_RESET) != 0;
 }
 
+static inline bool pipe_write_claimed(struct k_pipe *pipe)
+{
+	return (pipe->flags & PIPE_FLAG_WRITE_CLAIMED) != 0;
+}
+
+static inline bool pipe_read_claimed(struct k_pipe *pipe)
+{
+	return (pipe->flags & PIPE_FLAG_READ_CLAIMED) != 0;
+}
+
 static inline bool pipe_full(struct k_pipe *pipe)
 {
 	return ring_buf_space_get(&pipe->buf) == 0;
@@ -165,7 +175,7 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 			break;
 		}
 
-		if (pipe_empty(pipe)) {
+		if (pipe_empty(pipe) && !pipe_write_claimed(pipe)) {
 			if (IS_ENABLED(CONFIG_KERNEL_COHERENCE)) {
 				/*
 				 * Systems that enabled this option don't have
@@ -193,7 +203,10 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 							 K_POLL_STATE_PIPE_DATA_AVAILABLE);
 #endif /* CONFIG_POLL */
 
-		written += ring_buf_put(&pipe->buf, &data[written], len - written);
+		/* a claimed area must be committed before anything else is written */
+		if (likely(!pipe_write_claimed(pipe))) {
+			written += ring_buf_put(&pipe->buf, &data[written], len - written);
+		}
 		if (likely(written == len)) {
 			rc = written;
 			break;
@@ -238,7 +251,10 @@ int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout
 			need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
 		}
 
-		buf.used += ring_buf_get(&pipe->buf, &data[buf.used], len - buf.used);
+		/* a claimed area must be released before anything else is read */
+		if (likely(!pipe_read_claimed(pipe))) {
+			buf.used += ring_buf_get(&pipe->buf, &data[buf.used], len - buf.used);
+		}
 		if (likely(buf.used == len)) {
 			rc = buf.used;
 			break;
@@ -270,11 +286,199 @@ exit:
 	return rc;
 }
 
+int k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len, k_timeout_t timeout)
+{
+	int rc;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	if (len == 0) {
+		rc = -EINVAL;
+		goto exit;
+	}
+
+	if (ring_buf_capacity_get(&pipe->buf) == 0) {
+		/* no ring buffer to hand out */
+		rc = -ENOTSUP;
+		goto exit;
+	}
+
+	for (;;) {
+		if (unlikely(pipe_closed(pipe))) {
+			rc = -EPIPE;
+			break;
+		}
+
+		if (!pipe_write_claimed(pipe)) {
+			rc = ring_buf_put_claim(&pipe->buf, data, MIN(len, INT_MAX));
+			if (rc > 0) {
+				pipe->flags |= PIPE_FLAG_WRITE_CLAIMED;
+				break;
+			}
+		}
+
+		rc = wait_for(&pipe->space, pipe, &key, end, &need_resched);
+		if (rc != 0) {
+			break;
+		}
+	}
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
+int k_pipe_write_commit(struct k_pipe *pipe, size_t len)
+{
+	int rc;
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	if (unlikely(!pipe_write_claimed(pipe))) {
+		rc = -EINVAL;
+		goto exit;
+	}
+
+	if (unlikely(pipe_closed(pipe))) {
+		/* nothing can be written to a closed pipe: drop the data */
+		(void)ring_buf_put_finish(&pipe->buf, 0);
+		pipe->flags &= ~PIPE_FLAG_WRITE_CLAIMED;
+		rc = -EPIPE;
+		goto exit;
+	}
+
+	rc = (len > INT_MAX) ? -EINVAL : ring_buf_put_finish(&pipe->buf, len);
+	if (rc != 0) {
+		/* keep the claim so that a valid length can be committed */
+		goto exit;
+	}
+	pipe->flags &= ~PIPE_FLAG_WRITE_CLAIMED;
+
+	if (pipe->waiting != 0) {
+		/* readers may now find data, writers may now write */
+		need_resched = z_sched_wake_all(&pipe->data, 0, NULL);
+		need_resched |= z_sched_wake_all(&pipe->space, 0, NULL);
+	}
+
+#ifdef CONFIG_POLL
+	if (len != 0) {
+		need_resched |= z_handle_obj_poll_events(&pipe->poll_events,
+							 K_POLL_STATE_PIPE_DATA_AVAILABLE);
+	}
+#endif /* CONFIG_POLL */
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
+int k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len, k_timeout_t timeout)
+{
+	/* no "direct copy" wanted from writers: just be woken up */
+	uint8_t none;
+	struct pipe_buf_spec buf = { &none, 0, 0 };
+	int rc;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	if (len == 0) {
+		rc = -EINVAL;
+		goto exit;
+	}
+
+	if (ring_buf_capacity_get(&pipe->buf) == 0) {
+		/* no ring buffer to hand out */
+		rc = -ENOTSUP;
+		goto exit;
+	}
+
+	for (;;) {
+		if (!pipe_read_claimed(pipe)) {
+			rc = ring_buf_get_claim(&pipe->buf, data, MIN(len, INT_MAX));
+			if (rc > 0) {
+				pipe->flags |= PIPE_FLAG_READ_CLAIMED;
+				break;
+			}
+		}
+
+		if (unlikely(pipe_closed(pipe))) {
+			rc = -EPIPE;
+			break;
+		}
+
+		_current->base.swap_data = &buf;
+
+		rc = wait_for(&pipe->data, pipe, &key, end, &need_resched);
+		if (rc != 0) {
+			break;
+		}
+	}
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
+int k_pipe_read_release(struct k_pipe *pipe, size_t len)
+{
+	int rc;
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	if (unlikely(!pipe_read_claimed(pipe))) {
+		rc = -EINVAL;
+		goto exit;
+	}
+
+	rc = (len > INT_MAX) ? -EINVAL : ring_buf_get_finish(&pipe->buf, len);
+	if (rc != 0) {
+		/* keep the claim so that a valid length can be released */
+		goto exit;
+	}
+	pipe->flags &= ~PIPE_FLAG_READ_CLAIMED;
+
+	if (pipe->waiting != 0) {
+		/* writers may now find space, readers may now read */
+		need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
+		need_resched |= z_sched_wake_all(&pipe->data, 0, NULL);
+	}
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
 void z_impl_k_pipe_reset(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, reset, pipe);
 	K_SPINLOCK(&pipe->lock) {
 		ring_buf_reset(&pipe->buf);
+		/* outstanding claims are cancelled along with the data */
+		pipe->flags &= ~(PIPE_FLAG_WRITE_CLAIMED | PIPE_FLAG_READ_CLAIMED);
 		if (likely(pipe->waiting != 0)) {
 			pipe->flags |= PIPE_FLAG_RESET;
 			z_sched_wake_all(&pipe->data, 0, NULL);
@@ -288,7 +492,8 @@ void z_impl_k_pipe_close(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, close, pipe);
 	K_SPINLOCK(&pipe->lock) {
-		pipe->flags = 0;
+		/* the remaining data can still be read, so keep the claims */
+		pipe->flags &= PIPE_FLAG_WRITE_CLAIMED | PIPE_FLAG_READ_CLAIMED;
 		z_sched_wake_all(&pipe->data, 0, NULL);
 		z_sched_wake_all(&pipe->space, 0, NULL);
 	}
@@ -35,10 +35,11 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+static int signal_poll_set(struct k_poll_event *event, uint32_t state);
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -82,7 +83,7 @@ static inline bool is_condition_met(struct k_poll_event *event, uint32_t *state)
 		}
 		break;
 	case K_POLL_TYPE_MSGQ_DATA_AVAILABLE:
-		if (event->msgq->used_msgs > 0) {
+		if (z_impl_k_msgq_num_used_get(event->msgq) > 0U) {
 			*state = K_POLL_STATE_MSGQ_DATA_AVAILABLE;
 			return true;
 		}
@@ -108,6 +109,21 @@ static struct k_thread *poller_thread(struct z_poller *p)
 	return p ? CONTAINER_OF(p, struct k_thread, poller) : NULL;
 }
 
+/* Poll sets have no priority of their own and are notified after threads */
+static inline int poller_prio_cmp(struct z_poller *poller_1,
+				  struct z_poller *poller_2)
+{
+	if (poller_2->mode == MODE_SET) {
+		return (poller_1->mode == MODE_SET) ? 0 : 1;
+	}
+
+	if (poller_1->mode == MODE_SET) {
+		return -1;
+	}
+
+	return z_sched_prio_cmp(poller_thread(poller_1), poller_thread(poller_2));
+}
+
 static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 			     struct z_poller *poller)
 {
@@ -115,15 +131,13 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
 	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+		(poller_prio_cmp(pending->poller, poller) >= 0)) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if (poller_prio_cmp(poller, pending->poller) > 0) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -436,6 +450,10 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 	struct z_poller *poller = event->poller;
 	int retcode = 0;
 
+	if ((poller != NULL) && (poller->mode == MODE_SET)) {
+		return signal_poll_set(event, state);
+	}
+
 	if (poller != NULL) {
 		if (poller->mode == MODE_POLL) {
 			retcode = signal_poller(event, state);
@@ -808,3 +826,138 @@ int k_work_poll_cancel(struct k_work_poll *work)
 
 	return retval;
 }
+
+/* must be called with interrupts locked */
+static int signal_poll_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set = CONTAINER_OF(event->poller, struct k_poll_set,
+					      poller);
+
+	/* The object already dropped the event from its list */
+	event->state |= state;
+	sys_dlist_append(&set->ready, &event->_node);
+	(void)z_sched_wake(&set->wait_q, 0, NULL);
+
+	return 0;
+}
+
+/* must be called with interrupts locked */
+static void poll_set_arm(struct k_poll_set *set, struct k_poll_event *event)
+{
+	uint32_t state;
+
+	event->state = K_POLL_STATE_NOT_READY;
+
+	if (is_condition_met(event, &state)) {
+		event->state = state;
+		event->poller = &set->poller;
+		sys_dlist_append(&set->ready, &event->_node);
+	} else {
+		register_event(event, &set->poller);
+	}
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	set->poller.is_polling = true;
+	set->poller.mode = MODE_SET;
+	sys_dlist_init(&set->ready);
+	sys_dlist_init(&set->reported);
+	z_waitq_init(&set->wait_q);
+}
+
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (event->poller != NULL) {
+		k_spin_unlock(&lock, key);
+		return -EBUSY;
+	}
+
+	poll_set_arm(set, event);
+
+	/* An event added while available wakes a waiter right away */
+	if ((event->state != K_POLL_STATE_NOT_READY) &&
+	    z_sched_wake(&set->wait_q, 0, NULL)) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return 0;
+}
+
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int ret = 0;
+
+	if (event->poller != &set->poller) {
+		ret = -EINVAL;
+	} else {
+		/* The event is either on its object, ready or reported */
+		if (sys_dnode_is_linked(&event->_node)) {
+			sys_dlist_remove(&event->_node);
+		}
+		event->poller = NULL;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int max_events, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct k_poll_event *event;
+	k_spinlock_key_t key;
+	sys_dnode_t *node;
+	int num_ready = 0;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+	__ASSERT(ready != NULL, "NULL ready\n");
+
+	if (max_events <= 0) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&lock);
+
+	/* Events returned by the previous wait go back on their objects,
+	 * unless they are still available.
+	 */
+	while ((node = sys_dlist_get(&set->reported)) != NULL) {
+		poll_set_arm(set, CONTAINER_OF(node, struct k_poll_event, _node));
+	}
+
+	/* Another waiter may take the events it was woken for */
+	while (sys_dlist_is_empty(&set->ready)) {
+		timeout = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EAGAIN;
+		}
+
+		ret = z_pend_curr(&lock, key, &set->wait_q, timeout);
+		if (ret != 0) {
+			return ret;
+		}
+
+		key = k_spin_lock(&lock);
+	}
+
+	while ((num_ready < max_events) &&
+	       ((node = sys_dlist_get(&set->ready)) != NULL)) {
+		event = CONTAINER_OF(node, struct k_poll_event, _node);
+		sys_dlist_append(&set->reported, node);
+		ready[num_ready++] = event;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return num_ready;
+}
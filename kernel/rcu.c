@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Read-copy-update.
+ *
+ * Grace periods are numbered.  Grace period N starts when an updater asks
+ * for it, and ends once every CPU went through a quiescent state since
+ * then, and no thread switched out inside a read-side critical section
+ * started before it is still inside it.
+ *
+ * A CPU goes through a quiescent state when it switches threads, when
+ * its idle loop runs, and when it is seen running its idle thread outside
+ * of an ISR.  A thread switched out inside a read-side critical section
+ * is counted in the grace period that its critical section holds up: the
+ * current one if its CPU did not go through a quiescent state yet,
+ * otherwise the next one.  Only two grace periods can have such threads,
+ * so the counts are kept by parity.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/rcu.h>
+#include <zephyr/spinlock.h>
+#include <ksched.h>
+
+static struct k_spinlock rcu_lock;
+
+/* Last grace period started, and last one ended */
+static uint32_t rcu_gp;
+static uint32_t rcu_gp_done;
+
+/* Last grace period some updater waits for */
+static uint32_t rcu_gp_requested;
+
+/* Threads switched out inside a read-side critical section, by grace
+ * period parity
+ */
+static uint32_t rcu_blocked[2];
+
+/* Callbacks waiting for grace period rcu_cbs_gp, and newer ones */
+static sys_slist_t rcu_cbs_wait = SYS_SLIST_STATIC_INIT(&rcu_cbs_wait);
+static sys_slist_t rcu_cbs_next = SYS_SLIST_STATIC_INIT(&rcu_cbs_next);
+static uint32_t rcu_cbs_gp;
+
+static void rcu_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(rcu_work, rcu_work_handler);
+
+static inline bool rcu_gp_before(uint32_t a, uint32_t b)
+{
+	return (int32_t)(a - b) < 0;
+}
+
+static bool rcu_gp_quiescent(uint32_t gp)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	if (rcu_blocked[gp & 1U] != 0U) {
+		return false;
+	}
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct _cpu *cpu = &_kernel.cpus[i];
+
+		if (cpu->rcu_qs_gp == gp) {
+			continue;
+		}
+
+		/* Not started, or idle */
+		if ((cpu->current == NULL) ||
+		    ((cpu->current == cpu->idle_thread) &&
+		     (cpu->rcu_isr_nesting == 0U))) {
+			continue;
+		}
+
+		return false;
+	}
+
+	return true;
+}
+
+/* Returns the grace period to wait for, for the readers in progress */
+static uint32_t rcu_request(void)
+{
+	/* A grace period already started may not cover them */
+	uint32_t gp = rcu_gp + 1U;
+
+	if (rcu_gp_before(rcu_gp_requested, gp)) {
+		rcu_gp_requested = gp;
+	}
+
+	return gp;
+}
+
+/* Called from a thread outside of any read-side critical section */
+static void rcu_gp_advance(void)
+{
+	while (true) {
+		if (rcu_gp == rcu_gp_done) {
+			if (!rcu_gp_before(rcu_gp, rcu_gp_requested)) {
+				return;
+			}
+			rcu_gp++;
+		}
+
+		_current_cpu->rcu_qs_gp = rcu_gp;
+
+		if (!rcu_gp_quiescent(rcu_gp)) {
+			return;
+		}
+		rcu_gp_done = rcu_gp;
+	}
+}
+
+void z_rcu_switched_out(struct k_thread *thread)
+{
+	k_spinlock_key_t key;
+	uint32_t gp;
+
+	if ((thread->base.rcu_nesting == 0U) || thread->base.rcu_blocked) {
+		_current_cpu->rcu_qs_gp = rcu_gp;
+		return;
+	}
+
+	key = k_spin_lock(&rcu_lock);
+
+	gp = rcu_gp;
+	if ((gp == rcu_gp_done) || (_current_cpu->rcu_qs_gp == gp)) {
+		/* Entered after this CPU went through a quiescent state */
+		gp++;
+	}
+
+	thread->base.rcu_blocked = true;
+	thread->base.rcu_gp = gp;
+	rcu_blocked[gp & 1U]++;
+
+	_current_cpu->rcu_qs_gp = rcu_gp;
+
+	k_spin_unlock(&rcu_lock, key);
+}
+
+void z_rcu_quiescent(void)
+{
+	_current_cpu->rcu_qs_gp = rcu_gp;
+}
+
+void k_rcu_read_lock(void)
+{
+	if (k_is_in_isr()) {
+		_current_cpu->rcu_isr_nesting++;
+		/* Idle CPUs are inspected from other CPUs */
+		barrier_dmem_fence_full();
+		return;
+	}
+
+	_current->base.rcu_nesting++;
+	compiler_barrier();
+}
+
+static void rcu_read_unlock_blocked(struct k_thread *thread)
+{
+	k_spinlock_key_t key = k_spin_lock(&rcu_lock);
+
+	thread->base.rcu_blocked = false;
+	rcu_blocked[thread->base.rcu_gp & 1U]--;
+
+	k_spin_unlock(&rcu_lock, key);
+}
+
+void k_rcu_read_unlock(void)
+{
+	struct k_thread *thread;
+
+	if (k_is_in_isr()) {
+		__ASSERT(_current_cpu->rcu_isr_nesting > 0U,
+			 "not in an RCU read-side critical section");
+		barrier_dmem_fence_full();
+		_current_cpu->rcu_isr_nesting--;
+		return;
+	}
+
+	thread = _current;
+
+	__ASSERT(thread->base.rcu_nesting > 0U,
+		 "not in an RCU read-side critical section");
+
+	compiler_barrier();
+	thread->base.rcu_nesting--;
+	compiler_barrier();
+
+	/* Only ever set while switched out inside the critical section */
+	if ((thread->base.rcu_nesting == 0U) && thread->base.rcu_blocked) {
+		rcu_read_unlock_blocked(thread);
+	}
+}
+
+static bool rcu_gp_ended(uint32_t gp)
+{
+	k_spinlock_key_t key = k_spin_lock(&rcu_lock);
+	bool ended;
+
+	rcu_gp_advance();
+	ended = !rcu_gp_before(rcu_gp_done, gp);
+
+	k_spin_unlock(&rcu_lock, key);
+
+	return ended;
+}
+
+void k_rcu_synchronize(void)
+{
+	k_spinlock_key_t key;
+	uint32_t gp;
+
+	__ASSERT(!k_is_in_isr(), "k_rcu_synchronize() called from an ISR");
+	__ASSERT(_current->base.rcu_nesting == 0U,
+		 "k_rcu_synchronize() called in a read-side critical section");
+
+	key = k_spin_lock(&rcu_lock);
+	gp = rcu_request();
+	k_spin_unlock(&rcu_lock, key);
+
+	/* Sleeping also is a quiescent state of this CPU */
+	while (!rcu_gp_ended(gp)) {
+		k_sleep(K_TICKS(1));
+	}
+}
+
+void k_rcu_call(struct k_rcu_head *head, k_rcu_callback_t func)
+{
+	k_spinlock_key_t key = k_spin_lock(&rcu_lock);
+
+	head->func = func;
+	sys_slist_append(&rcu_cbs_next, &head->node);
+
+	k_spin_unlock(&rcu_lock, key);
+
+	(void)k_work_schedule(&rcu_work, K_NO_WAIT);
+}
+
+static void rcu_work_handler(struct k_work *work)
+{
+	k_spinlock_key_t key = k_spin_lock(&rcu_lock);
+	sys_slist_t ready = SYS_SLIST_STATIC_INIT(&ready);
+	sys_snode_t *node;
+	bool pending;
+	bool ran;
+
+	ARG_UNUSED(work);
+
+	if (sys_slist_is_empty(&rcu_cbs_wait) &&
+	    !sys_slist_is_empty(&rcu_cbs_next)) {
+		rcu_cbs_wait = rcu_cbs_next;
+		sys_slist_init(&rcu_cbs_next);
+		rcu_cbs_gp = rcu_request();
+	}
+
+	rcu_gp_advance();
+
+	if (!sys_slist_is_empty(&rcu_cbs_wait) &&
+	    !rcu_gp_before(rcu_gp_done, rcu_cbs_gp)) {
+		ready = rcu_cbs_wait;
+		sys_slist_init(&rcu_cbs_wait);
+	}
+
+	pending = !sys_slist_is_empty(&rcu_cbs_wait) ||
+		  !sys_slist_is_empty(&rcu_cbs_next);
+
+	k_spin_unlock(&rcu_lock, key);
+
+	ran = !sys_slist_is_empty(&ready);
+
+	while ((node = sys_slist_get(&ready)) != NULL) {
+		struct k_rcu_head *head = CONTAINER_OF(node, struct k_rcu_head, node);
+
+		head->func(head);
+	}
+
+	if (pending) {
+		/* Newer callbacks need a grace period of their own */
+		(void)k_work_schedule(&rcu_work, ran ? K_NO_WAIT : K_TICKS(1));
+	}
+}
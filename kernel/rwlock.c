@@ -0,0 +1,526 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file @brief reader-writer lock kernel services
+ *
+ * The state of a reader-writer lock is a single atomic word, holding either
+ * the number of readers or the address of the writer thread, along with a
+ * flag telling that threads are waiting for the lock.  As long as the flag
+ * is clear, locking and unlocking is a compare-and-swap of the state.  Once
+ * it is set, the state is only changed with the global lock held, so that
+ * the lock can be handed over to the waiting threads.
+ *
+ * Writers are preferred: readers wait as long as a writer does.  The writer
+ * inherits the priority of the threads waiting for the lock, with the same
+ * nesting rules as mutexes.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/toolchain.h>
+#include <ksched.h>
+#include <wait_q.h>
+#include <errno.h>
+#include <string.h>
+#include <zephyr/init.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/check.h>
+
+/* Held for writing, by the thread whose address is in the other bits */
+#define RWLOCK_WRITER  BIT(0)
+/* Threads are waiting, the state is protected by the global lock */
+#define RWLOCK_WAITERS BIT(1)
+/* One reader, the number of readers being in the other bits */
+#define RWLOCK_READER  BIT(2)
+
+#define RWLOCK_FLAGS   (RWLOCK_WRITER | RWLOCK_WAITERS)
+
+BUILD_ASSERT(__alignof(struct k_thread) > RWLOCK_FLAGS,
+	     "thread addresses do not leave room for the lock flags");
+
+static struct k_spinlock lock;
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+static struct k_obj_type obj_type_rwlock;
+
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+static int k_rwlock_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_rwlock *rwlock;
+	k_spinlock_key_t key;
+
+	rwlock = CONTAINER_OF(obj_core, struct k_rwlock, obj_core);
+	key = k_spin_lock(&lock);
+	memcpy(stats, &rwlock->stats, sizeof(rwlock->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static int k_rwlock_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_rwlock *rwlock;
+	k_spinlock_key_t key;
+
+	rwlock = CONTAINER_OF(obj_core, struct k_rwlock, obj_core);
+	key = k_spin_lock(&lock);
+	rwlock->stats.read_waits = 0U;
+	rwlock->stats.write_waits = 0U;
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc rwlock_stats_desc = {
+	.raw_size = sizeof(struct k_rwlock_stats),
+	.query_size = sizeof(struct k_rwlock_stats),
+	.raw   = k_rwlock_stats_raw,
+	.query = k_rwlock_stats_raw,
+	.reset = k_rwlock_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
+
+static inline struct k_thread *rwlock_writer(atomic_val_t state)
+{
+	return ((state & RWLOCK_WRITER) != 0U) ?
+	       (struct k_thread *)(state & ~RWLOCK_FLAGS) : NULL;
+}
+
+static inline atomic_val_t rwlock_writer_state(struct k_thread *thread)
+{
+	return (atomic_val_t)(uintptr_t)thread | RWLOCK_WRITER;
+}
+
+/*
+ * Sets the waiters flag, so that the lock-free paths leave the state
+ * alone, and returns the state without it.  Called with the lock held.
+ */
+static atomic_val_t rwlock_claim(struct k_rwlock *rwlock)
+{
+	atomic_val_t state = atomic_or(&rwlock->state, RWLOCK_WAITERS);
+	struct k_thread *writer = rwlock_writer(state);
+
+	/* A writer that took the lock while nobody was waiting has neither
+	 * recorded its priority nor been lent any.
+	 */
+	if ((writer != NULL) && ((state & RWLOCK_WAITERS) == 0U)) {
+		rwlock->writer_orig_prio = writer->base.prio;
+	}
+
+	return state & ~RWLOCK_WAITERS;
+}
+
+/*
+ * Publishes a new state, the waiters flag being kept only while threads
+ * are waiting.  Called with the lock held.
+ */
+static void rwlock_publish(struct k_rwlock *rwlock, atomic_val_t state)
+{
+	if ((z_waitq_head(&rwlock->read_wait_q) != NULL) ||
+	    (z_waitq_head(&rwlock->write_wait_q) != NULL)) {
+		state |= RWLOCK_WAITERS;
+	}
+
+	atomic_set(&rwlock->state, state);
+}
+
+static int32_t new_prio_for_inheritance(int32_t target, int32_t limit)
+{
+	int new_prio = z_is_prio_higher(target, limit) ? target : limit;
+
+	new_prio = z_get_new_prio_with_ceiling(new_prio);
+
+	return new_prio;
+}
+
+/* Sets the priority of the writer from the threads waiting for the lock */
+static bool writer_prio_update(struct k_rwlock *rwlock, struct k_thread *writer)
+{
+	struct k_thread *reader = z_waitq_head(&rwlock->read_wait_q);
+	struct k_thread *waiter = z_waitq_head(&rwlock->write_wait_q);
+	int new_prio = rwlock->writer_orig_prio;
+
+	if ((reader != NULL) &&
+	    ((waiter == NULL) || z_is_prio_higher(reader->base.prio, waiter->base.prio))) {
+		waiter = reader;
+	}
+
+	if (waiter != NULL) {
+		new_prio = new_prio_for_inheritance(waiter->base.prio,
+						    rwlock->writer_orig_prio);
+	}
+
+	if (writer->base.prio != new_prio) {
+		return z_thread_prio_set(writer, new_prio);
+	}
+
+	return false;
+}
+
+/* Wakes up the waiting readers, returns the state they add to the lock */
+static atomic_val_t rwlock_wake_readers(struct k_rwlock *rwlock)
+{
+	struct k_thread *thread;
+	atomic_val_t readers = 0;
+
+	for (thread = z_unpend_first_thread(&rwlock->read_wait_q); thread != NULL;
+	     thread = z_unpend_first_thread(&rwlock->read_wait_q)) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		readers += RWLOCK_READER;
+	}
+
+	return readers;
+}
+
+/* Makes the first waiting writer hold the lock, returns the new state */
+static atomic_val_t rwlock_wake_writer(struct k_rwlock *rwlock)
+{
+	struct k_thread *writer = z_unpend_first_thread(&rwlock->write_wait_q);
+
+	if (writer == NULL) {
+		return 0;
+	}
+
+	rwlock->writer_orig_prio = writer->base.prio;
+	arch_thread_return_value_set(writer, 0);
+	z_ready_thread(writer);
+
+	/* Readers waiting behind it may have a higher priority */
+	(void)writer_prio_update(rwlock, writer);
+
+	return rwlock_writer_state(writer);
+}
+
+/*
+ * Pends the current thread until the lock is handed over to it, lending
+ * its priority to the writer holding the lock, if any.  Called with the
+ * lock held and the state claimed.
+ */
+static int rwlock_wait(struct k_rwlock *rwlock, _wait_q_t *wait_q,
+		       atomic_val_t state, k_spinlock_key_t key,
+		       k_timeout_t timeout)
+{
+	struct k_thread *writer = rwlock_writer(state);
+
+	if (writer != NULL) {
+		int new_prio = new_prio_for_inheritance(_current->base.prio,
+							writer->base.prio);
+
+		if (z_is_prio_higher(new_prio, writer->base.prio)) {
+			(void)z_thread_prio_set(writer, new_prio);
+		}
+	}
+
+	atomic_set(&rwlock->state, state | RWLOCK_WAITERS);
+
+	return z_pend_curr(&lock, key, wait_q, timeout);
+}
+
+/* Cleans up after the current thread gave up waiting for the lock */
+static void rwlock_wait_timeout(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	atomic_val_t state = rwlock_claim(rwlock);
+	struct k_thread *writer = rwlock_writer(state);
+	bool resched = false;
+
+	if (writer != NULL) {
+		resched = writer_prio_update(rwlock, writer);
+	} else if (z_waitq_head(&rwlock->write_wait_q) == NULL) {
+		/* Readers only waited for the writers to be done */
+		if (z_waitq_head(&rwlock->read_wait_q) != NULL) {
+			state += rwlock_wake_readers(rwlock);
+			resched = true;
+		}
+	}
+
+	rwlock_publish(rwlock, state);
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+}
+
+int z_impl_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	z_waitq_init(&rwlock->read_wait_q);
+	z_waitq_init(&rwlock->write_wait_q);
+	atomic_set(&rwlock->state, 0);
+	rwlock->writer_orig_prio = K_LOWEST_APPLICATION_THREAD_PRIO;
+
+	k_object_init(rwlock);
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+	k_obj_core_init_and_link(K_OBJ_CORE(rwlock), &obj_type_rwlock);
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	rwlock->stats.read_waits = 0U;
+	rwlock->stats.write_waits = 0U;
+	k_obj_core_stats_register(K_OBJ_CORE(rwlock), &rwlock->stats,
+				  sizeof(struct k_rwlock_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ_INIT(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_init(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_init_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	atomic_val_t state = atomic_get(&rwlock->state);
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr(), "reader-writer locks cannot be used inside ISRs");
+
+	while ((state & RWLOCK_FLAGS) == 0U) {
+		if (atomic_cas(&rwlock->state, state, state + RWLOCK_READER)) {
+			return 0;
+		}
+		state = atomic_get(&rwlock->state);
+	}
+
+	key = k_spin_lock(&lock);
+	state = rwlock_claim(rwlock);
+
+	if ((rwlock_writer(state) == NULL) &&
+	    (z_waitq_head(&rwlock->write_wait_q) == NULL)) {
+		rwlock_publish(rwlock, state + RWLOCK_READER);
+		k_spin_unlock(&lock, key);
+
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		rwlock_publish(rwlock, state);
+		k_spin_unlock(&lock, key);
+
+		return -EBUSY;
+	}
+
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	rwlock->stats.read_waits++;
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+
+	/* The thread waking this one up counts it as a reader */
+	if (rwlock_wait(rwlock, &rwlock->read_wait_q, state, key, timeout) == 0) {
+		return 0;
+	}
+
+	rwlock_wait_timeout(rwlock);
+
+	return -EAGAIN;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_lock(struct k_rwlock *rwlock,
+					    k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_lock(rwlock, timeout);
+}
+#include <zephyr/syscalls/k_rwlock_read_lock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_read_unlock(struct k_rwlock *rwlock)
+{
+	atomic_val_t state = atomic_get(&rwlock->state);
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr(), "reader-writer locks cannot be used inside ISRs");
+
+	while ((state & RWLOCK_WAITERS) == 0U) {
+		CHECKIF(((state & RWLOCK_WRITER) != 0U) || (state == 0)) {
+			return -EINVAL;
+		}
+
+		if (atomic_cas(&rwlock->state, state, state - RWLOCK_READER)) {
+			return 0;
+		}
+		state = atomic_get(&rwlock->state);
+	}
+
+	key = k_spin_lock(&lock);
+	state = rwlock_claim(rwlock);
+
+	CHECKIF(((state & RWLOCK_WRITER) != 0U) || (state == 0)) {
+		rwlock_publish(rwlock, state);
+		k_spin_unlock(&lock, key);
+
+		return -EINVAL;
+	}
+
+	state -= RWLOCK_READER;
+
+	/* The last reader hands the lock over to the first waiting writer */
+	if ((state == 0) && (z_waitq_head(&rwlock->write_wait_q) != NULL)) {
+		rwlock_publish(rwlock, rwlock_wake_writer(rwlock));
+		z_reschedule(&lock, key);
+	} else {
+		rwlock_publish(rwlock, state);
+		k_spin_unlock(&lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_unlock(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_unlock(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_read_unlock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	atomic_val_t state;
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr(), "reader-writer locks cannot be used inside ISRs");
+
+	if (likely(atomic_cas(&rwlock->state, 0, rwlock_writer_state(_current)))) {
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+	state = rwlock_claim(rwlock);
+
+	__ASSERT(rwlock_writer(state) != _current,
+		 "reader-writer lock %p already held for writing", rwlock);
+
+	if (state == 0) {
+		rwlock->writer_orig_prio = _current->base.prio;
+		rwlock_publish(rwlock, rwlock_writer_state(_current));
+		k_spin_unlock(&lock, key);
+
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		rwlock_publish(rwlock, state);
+		k_spin_unlock(&lock, key);
+
+		return -EBUSY;
+	}
+
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	rwlock->stats.write_waits++;
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+
+	/* The thread waking this one up makes it the writer */
+	if (rwlock_wait(rwlock, &rwlock->write_wait_q, state, key, timeout) == 0) {
+		return 0;
+	}
+
+	rwlock_wait_timeout(rwlock);
+
+	return -EAGAIN;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_lock(struct k_rwlock *rwlock,
+					     k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_lock(rwlock, timeout);
+}
+#include <zephyr/syscalls/k_rwlock_write_lock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_write_unlock(struct k_rwlock *rwlock)
+{
+	atomic_val_t state;
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr(), "reader-writer locks cannot be used inside ISRs");
+
+	if (likely(atomic_cas(&rwlock->state, rwlock_writer_state(_current), 0))) {
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+	state = rwlock_claim(rwlock);
+
+	CHECKIF(rwlock_writer(state) != _current) {
+		rwlock_publish(rwlock, state);
+		k_spin_unlock(&lock, key);
+
+		return -EPERM;
+	}
+
+	/* Give back the priority lent by the waiting threads */
+	if (_current->base.prio != rwlock->writer_orig_prio) {
+		(void)z_thread_prio_set(_current, rwlock->writer_orig_prio);
+	}
+
+	/* Writers go first, otherwise all the readers get the lock */
+	if (z_waitq_head(&rwlock->write_wait_q) != NULL) {
+		state = rwlock_wake_writer(rwlock);
+	} else {
+		state = rwlock_wake_readers(rwlock);
+	}
+
+	rwlock_publish(rwlock, state);
+	z_reschedule(&lock, key);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_unlock(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_unlock(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_write_unlock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+static int init_rwlock_obj_core_list(void)
+{
+	/* Initialize reader-writer lock object type */
+
+	z_obj_type_init(&obj_type_rwlock, K_OBJ_TYPE_RWLOCK_ID,
+			offsetof(struct k_rwlock, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	k_obj_type_stats_init(&obj_type_rwlock, &rwlock_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+
+	/* Initialize and link statically defined reader-writer locks */
+
+	STRUCT_SECTION_FOREACH(k_rwlock, rwlock) {
+		k_obj_core_init_and_link(K_OBJ_CORE(rwlock), &obj_type_rwlock);
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+		k_obj_core_stats_register(K_OBJ_CORE(rwlock), &rwlock->stats,
+					  sizeof(struct k_rwlock_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+	}
+
+	return 0;
+}
+
+SYS_INIT(init_rwlock_obj_core_list, PRE_KERNEL_1,
+	 CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
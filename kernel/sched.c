@@ -335,7 +335,11 @@ static struct _cpu *thread_active_elsewhere(struct k_thread *thread)
 	return NULL;
 }
 
-static void ready_thread(struct k_thread *thread)
+/* Queues a thread that became ready, adding the CPUs to interrupt for it
+ * to @a ipi_mask. The caller updates the cache and flags the IPIs, only once
+ * when a batch of threads becomes ready at the same time.
+ */
+static bool queue_ready_thread(struct k_thread *thread, uint32_t *ipi_mask)
 {
 #ifdef CONFIG_KERNEL_COHERENCE
 	__ASSERT_NO_MSG(arch_mem_coherent(thread));
@@ -348,9 +352,27 @@ static void ready_thread(struct k_thread *thread)
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
 		queue_thread(thread);
-		update_cache(0);
+		z_sched_latency_ready(thread);
+		*ipi_mask |= (uint32_t)ipi_mask_create(thread);
+
+		return true;
+	}
+
+	return false;
+}
+
+static void ready_threads_queued(uint32_t ipi_mask)
+{
+	update_cache(0);
+	flag_ipi(ipi_mask);
+}
 
-		flag_ipi(ipi_mask_create(thread));
+static void ready_thread(struct k_thread *thread)
+{
+	uint32_t ipi_mask = 0U;
+
+	if (queue_ready_thread(thread, &ipi_mask)) {
+		ready_threads_queued(ipi_mask);
 	}
 }
 
@@ -578,33 +600,66 @@ void z_unpend_thread_no_timeout(struct k_thread *thread)
 	}
 }
 
-void z_sched_wake_thread(struct k_thread *thread, bool is_timeout)
+static bool wake_thread(struct k_thread *thread, bool is_timeout,
+			uint32_t *ipi_mask)
 {
-	K_SPINLOCK(&_sched_spinlock) {
-		bool killed = (thread->base.thread_state &
-				(_THREAD_DEAD | _THREAD_ABORTING));
+	bool killed = (thread->base.thread_state &
+			(_THREAD_DEAD | _THREAD_ABORTING));
 
 #ifdef CONFIG_EVENTS
-		bool do_nothing = thread->no_wake_on_timeout && is_timeout;
+	bool do_nothing = thread->no_wake_on_timeout && is_timeout;
 
-		thread->no_wake_on_timeout = false;
+	thread->no_wake_on_timeout = false;
 
-		if (do_nothing) {
-			continue;
-		}
+	if (do_nothing) {
+		return false;
+	}
 #endif /* CONFIG_EVENTS */
 
-		if (!killed) {
-			/* The thread is not being killed */
-			if (thread->base.pended_on != NULL) {
-				unpend_thread_no_timeout(thread);
-			}
-			z_mark_thread_as_not_sleeping(thread);
-			ready_thread(thread);
+	if (killed) {
+		return false;
+	}
+
+	/* The thread is not being killed */
+	if (thread->base.pended_on != NULL) {
+		unpend_thread_no_timeout(thread);
+	}
+	z_mark_thread_as_not_sleeping(thread);
+
+	return queue_ready_thread(thread, ipi_mask);
+}
+
+void z_sched_wake_thread(struct k_thread *thread, bool is_timeout)
+{
+	uint32_t ipi_mask = 0U;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		if (wake_thread(thread, is_timeout, &ipi_mask)) {
+			ready_threads_queued(ipi_mask);
 		}
 	}
+}
 
+#ifdef CONFIG_EVENTS
+void z_sched_wake_event_threads(struct k_thread *head, int swap_retval)
+{
+	uint32_t ipi_mask = 0U;
+	bool queued = false;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		for (struct k_thread *thread = head; thread != NULL;
+		     thread = thread->next_event_link) {
+			z_thread_return_value_set_with_data(thread, swap_retval,
+							    NULL);
+			queued |= wake_thread(thread, false, &ipi_mask);
+		}
+
+		if (queued) {
+			ready_threads_queued(ipi_mask);
+		}
+	}
 }
+#endif /* CONFIG_EVENTS */
 
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 /* Timeout handler for *_thread_timeout() APIs */
@@ -826,6 +881,9 @@ static inline void set_current(struct k_thread *new_thread)
 	if (IS_ENABLED(CONFIG_INSTRUMENT_THREAD_SWITCHING) && new_thread != _current) {
 		z_thread_mark_switched_out();
 	}
+	if (IS_ENABLED(CONFIG_SCHED_THREAD_LATENCY) && new_thread != _current) {
+		z_sched_latency_switch(_current, new_thread);
+	}
 	z_current_thread_set(new_thread);
 }
 
@@ -938,16 +996,28 @@ void *z_get_next_switch_handle(void *interrupted)
 
 int z_unpend_all(_wait_q_t *wait_q)
 {
-	int need_sched = 0;
+	int woken = 0;
+	uint32_t ipi_mask = 0U;
+	bool queued = false;
 	struct k_thread *thread;
 
-	for (thread = z_waitq_head(wait_q); thread != NULL; thread = z_waitq_head(wait_q)) {
-		z_unpend_thread(thread);
-		z_ready_thread(thread);
-		need_sched = 1;
+	K_SPINLOCK(&_sched_spinlock) {
+		for (thread = _priq_wait_best(&wait_q->waitq); thread != NULL;
+		     thread = _priq_wait_best(&wait_q->waitq)) {
+			unpend_thread_no_timeout(thread);
+			z_abort_thread_timeout(thread);
+			if (thread_active_elsewhere(thread) == NULL) {
+				queued |= queue_ready_thread(thread, &ipi_mask);
+			}
+			woken++;
+		}
+
+		if (queued) {
+			ready_threads_queued(ipi_mask);
+		}
 	}
 
-	return need_sched;
+	return woken;
 }
 
 void init_ready_q(struct _ready_q *ready_q)
@@ -1491,6 +1561,33 @@ bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data)
 	return ret;
 }
 
+int z_sched_wake_all(_wait_q_t *wait_q, int swap_retval, void *swap_data)
+{
+	int woken = 0;
+	uint32_t ipi_mask = 0U;
+	bool queued = false;
+	struct k_thread *thread;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		for (thread = _priq_wait_best(&wait_q->waitq); thread != NULL;
+		     thread = _priq_wait_best(&wait_q->waitq)) {
+			z_thread_return_value_set_with_data(thread,
+							    swap_retval,
+							    swap_data);
+			unpend_thread_no_timeout(thread);
+			z_abort_thread_timeout(thread);
+			queued |= queue_ready_thread(thread, &ipi_mask);
+			woken++;
+		}
+
+		if (queued) {
+			ready_threads_queued(ipi_mask);
+		}
+	}
+
+	return woken;
+}
+
 int z_sched_wait(struct k_spinlock *lock, k_spinlock_key_t key,
 		 _wait_q_t *wait_q, k_timeout_t timeout, void **data)
 {
@@ -28,6 +28,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <string.h>
 
 /* We use a system-wide lock to synchronize semaphores, which has
  * unfortunate performance impact vs. using a per-object lock
@@ -40,6 +41,49 @@ static struct k_spinlock lock;
 
 #ifdef CONFIG_OBJ_CORE_SEM
 static struct k_obj_type obj_type_sem;
+
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+static int k_sem_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_sem *sem;
+	k_spinlock_key_t key;
+
+	sem = CONTAINER_OF(obj_core, struct k_sem, obj_core);
+	key = k_spin_lock(&lock);
+	memcpy(stats, &sem->stats, sizeof(sem->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static int k_sem_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_sem *sem;
+	k_spinlock_key_t key;
+
+	sem = CONTAINER_OF(obj_core, struct k_sem, obj_core);
+	key = k_spin_lock(&lock);
+	sem->stats.spins = 0U;
+	sem->stats.acquired = 0U;
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc sem_stats_desc = {
+	.raw_size = sizeof(struct k_adaptive_spin_stats),
+	.query_size = sizeof(struct k_adaptive_spin_stats),
+	.raw   = k_sem_stats_raw,
+	.query = k_sem_stats_raw,
+	.reset = k_sem_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 #endif /* CONFIG_OBJ_CORE_SEM */
 
 int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
@@ -67,6 +111,12 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 
 #ifdef CONFIG_OBJ_CORE_SEM
 	k_obj_core_init_and_link(K_OBJ_CORE(sem), &obj_type_sem);
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	sem->stats.spins = 0U;
+	sem->stats.acquired = 0U;
+	k_obj_core_stats_register(K_OBJ_CORE(sem), &sem->stats,
+				  sizeof(struct k_adaptive_spin_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 #endif /* CONFIG_OBJ_CORE_SEM */
 
 	return 0;
@@ -129,6 +179,55 @@ static inline void z_vrfy_k_sem_give(struct k_sem *sem)
 #include <zephyr/syscalls/k_sem_give_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+static bool sem_spin_worthwhile(struct k_sem *sem)
+{
+	/* Gives go to pending threads first, and only a running thread
+	 * can give the semaphore soon.
+	 */
+	return (z_waitq_head(&sem->wait_q) == NULL) && z_other_cpus_busy();
+}
+
+/*
+ * Busy wait for an unavailable semaphore while other CPUs run threads
+ * that may give it.  Called and returns with the lock held, which is
+ * released while spinning.  Returns true if the semaphore became
+ * available, in which case the caller takes it.
+ */
+static bool sem_spin(struct k_sem *sem, k_spinlock_key_t *key)
+{
+	uint32_t start = k_cycle_get_32();
+
+	if (!sem_spin_worthwhile(sem)) {
+		return false;
+	}
+
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	sem->stats.spins++;
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
+
+	do {
+		k_spin_unlock(&lock, *key);
+
+		do {
+			z_adaptive_spin_relax();
+		} while ((*(volatile unsigned int *)&sem->count == 0U) &&
+			 z_adaptive_spin_time_left(start));
+
+		*key = k_spin_lock(&lock);
+
+		if (sem->count > 0U) {
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+			sem->stats.acquired++;
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
+			return true;
+		}
+	} while (sem_spin_worthwhile(sem) && z_adaptive_spin_time_left(start));
+
+	return false;
+}
+#endif /* CONFIG_ADAPTIVE_SPIN */
+
 int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 {
 	int ret;
@@ -153,6 +252,15 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 		goto out;
 	}
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+	if (sem_spin(sem, &key)) {
+		sem->count--;
+		k_spin_unlock(&lock, key);
+		ret = 0;
+		goto out;
+	}
+#endif /* CONFIG_ADAPTIVE_SPIN */
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_sem, take, sem, timeout);
 
 	ret = z_pend_curr(&lock, key, &sem->wait_q, timeout);
@@ -222,11 +330,18 @@ static int init_sem_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_sem, K_OBJ_TYPE_SEM_ID,
 			offsetof(struct k_sem, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	k_obj_type_stats_init(&obj_type_sem, &sem_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 
 	/* Initialize and link statically defined semaphores */
 
 	STRUCT_SECTION_FOREACH(k_sem, sem) {
 		k_obj_core_init_and_link(K_OBJ_CORE(sem), &obj_type_sem);
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+		k_obj_core_stats_register(K_OBJ_CORE(sem), &sem->stats,
+					  sizeof(struct k_adaptive_spin_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 	}
 
 	return 0;
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/syscall_batch.h>
+#include <zephyr/internal/syscall_handler.h>
+
+static int batch_run(const struct k_syscall_batch_entry *entry)
+{
+	switch (entry->id) {
+	case K_SYSCALL_K_SEM_GIVE:
+		z_impl_k_sem_give((struct k_sem *)entry->arg1);
+		return 0;
+	case K_SYSCALL_K_SEM_TAKE:
+		return z_impl_k_sem_take((struct k_sem *)entry->arg1, K_NO_WAIT);
+	case K_SYSCALL_K_MSGQ_PUT:
+		return z_impl_k_msgq_put((struct k_msgq *)entry->arg1,
+					 (const void *)entry->arg2, K_NO_WAIT);
+	case K_SYSCALL_K_MSGQ_GET:
+		return z_impl_k_msgq_get((struct k_msgq *)entry->arg1,
+					 (void *)entry->arg2, K_NO_WAIT);
+#ifdef CONFIG_POLL
+	case K_SYSCALL_K_POLL_SIGNAL_RAISE:
+		return z_impl_k_poll_signal_raise((struct k_poll_signal *)entry->arg1,
+						  (int)entry->arg2);
+#endif /* CONFIG_POLL */
+	default:
+		return -ENOSYS;
+	}
+}
+
+int z_impl_k_syscall_batch(struct k_syscall_batch_entry *entries,
+			   size_t num_entries)
+{
+	int failed = 0;
+
+	for (size_t i = 0; i < num_entries; i++) {
+		entries[i].ret = batch_run(&entries[i]);
+		if (entries[i].ret < 0) {
+			failed++;
+		}
+	}
+
+	return failed;
+}
+
+#ifdef CONFIG_USERSPACE
+/* Number of kernel objects whose validation is remembered during a batch.
+ * Batches are expected to hit a handful of objects over and over.
+ */
+#define BATCH_OBJ_CACHE_SIZE 4
+
+struct batch_obj_cache {
+	const void *obj[BATCH_OBJ_CACHE_SIZE];
+	enum k_objects otype[BATCH_OBJ_CACHE_SIZE];
+	unsigned int next;
+};
+
+/* Returns nonzero if the object is not valid, like K_SYSCALL_OBJ() */
+static int batch_obj_check(struct batch_obj_cache *cache, const void *obj,
+			   enum k_objects otype)
+{
+	for (unsigned int i = 0; i < BATCH_OBJ_CACHE_SIZE; i++) {
+		if ((cache->obj[i] == obj) && (cache->otype[i] == otype)) {
+			return 0;
+		}
+	}
+
+	if (K_SYSCALL_OBJ(obj, otype)) {
+		return 1;
+	}
+
+	cache->obj[cache->next] = obj;
+	cache->otype[cache->next] = otype;
+	cache->next = (cache->next + 1U) % BATCH_OBJ_CACHE_SIZE;
+
+	return 0;
+}
+
+/* Same checks as the verification function of each system call */
+static int batch_verify(struct batch_obj_cache *cache,
+			const struct k_syscall_batch_entry *entry)
+{
+	struct k_msgq *msgq = (struct k_msgq *)entry->arg1;
+
+	switch (entry->id) {
+	case K_SYSCALL_K_SEM_GIVE:
+	case K_SYSCALL_K_SEM_TAKE:
+		return batch_obj_check(cache, (void *)entry->arg1, K_OBJ_SEM);
+	case K_SYSCALL_K_MSGQ_PUT:
+		return batch_obj_check(cache, msgq, K_OBJ_MSGQ) ||
+		       K_SYSCALL_MEMORY_READ((void *)entry->arg2, msgq->msg_size);
+	case K_SYSCALL_K_MSGQ_GET:
+		return batch_obj_check(cache, msgq, K_OBJ_MSGQ) ||
+		       K_SYSCALL_MEMORY_WRITE((void *)entry->arg2, msgq->msg_size);
+#ifdef CONFIG_POLL
+	case K_SYSCALL_K_POLL_SIGNAL_RAISE:
+		return batch_obj_check(cache, (void *)entry->arg1,
+				       K_OBJ_POLL_SIGNAL);
+#endif /* CONFIG_POLL */
+	default:
+		/* Not run */
+		return 0;
+	}
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_batch_entry *entries,
+					 size_t num_entries)
+{
+	struct batch_obj_cache cache = { 0 };
+	struct k_syscall_batch_entry entry;
+	int failed = 0;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(entries, num_entries,
+					    sizeof(*entries)));
+
+	for (size_t i = 0; i < num_entries; i++) {
+		/* Other user threads may change the entry while it runs */
+		entry = entries[i];
+
+		K_OOPS(batch_verify(&cache, &entry));
+
+		entries[i].ret = batch_run(&entry);
+		if (entries[i].ret < 0) {
+			failed++;
+		}
+	}
+
+	return failed;
+}
+#include <zephyr/syscalls/k_syscall_batch_mrsh.c>
+#endif /* CONFIG_USERSPACE */
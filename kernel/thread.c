@@ -988,6 +988,10 @@ void z_thread_mark_switched_in(void)
 	z_sched_usage_start(_current);
 #endif /* CONFIG_SCHED_THREAD_USAGE && !CONFIG_USE_SWITCH */
 
+#if defined(CONFIG_SCHED_THREAD_LATENCY) && !defined(CONFIG_USE_SWITCH)
+	z_sched_latency_switch(NULL, _current);
+#endif /* CONFIG_SCHED_THREAD_LATENCY && !CONFIG_USE_SWITCH */
+
 #ifdef CONFIG_TRACING
 	SYS_PORT_TRACING_FUNC(k_thread, switched_in);
 #endif /* CONFIG_TRACING */
@@ -999,6 +1003,12 @@ void z_thread_mark_switched_out(void)
 	z_sched_usage_stop();
 #endif /*CONFIG_SCHED_THREAD_USAGE && !CONFIG_USE_SWITCH */
 
+#if defined(CONFIG_SCHED_THREAD_LATENCY) && !defined(CONFIG_USE_SWITCH)
+	z_sched_latency_switch(_current, NULL);
+#endif /* CONFIG_SCHED_THREAD_LATENCY && !CONFIG_USE_SWITCH */
+
+	z_rcu_switched_out(_current);
+
 #ifdef CONFIG_TRACING
 #ifdef CONFIG_THREAD_LOCAL_STORAGE
 	/* Dummy thread won't have TLS set up to run arbitrary code */
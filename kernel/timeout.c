@@ -14,8 +14,6 @@
 
 static uint64_t curr_tick;
 
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
-
 /*
  * The timeout code shall take no locks other than its own (timeout_lock), nor
  * shall it call any other subsystem while holding this lock.
@@ -25,6 +23,11 @@ static struct k_spinlock timeout_lock;
 /* Ticks left to process in the currently-executing sys_clock_announce() */
 static int announce_remaining;
 
+#ifdef CONFIG_TIMEOUT_STATS
+/* Protected by timeout_lock */
+static struct sys_clock_timeout_stats timeout_stats;
+#endif /* CONFIG_TIMEOUT_STATS */
+
 #if defined(CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME)
 unsigned int z_clock_hw_cycles_per_sec = CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
 
@@ -37,6 +40,91 @@ static inline unsigned int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+/*
+ * Pending timeouts are sorted in a red/black tree by absolute expiry
+ * tick, ties being broken by insertion order so that timeouts expiring
+ * on the same tick fire in the order they were added, as they do with
+ * the list backend.
+ */
+static bool timeout_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	struct _timeout *ta = CONTAINER_OF(a, struct _timeout, node);
+	struct _timeout *tb = CONTAINER_OF(b, struct _timeout, node);
+
+	if (ta->expiry != tb->expiry) {
+		return ta->expiry < tb->expiry;
+	}
+
+	return ta->order_key < tb->order_key;
+}
+
+static struct rbtree timeout_tree = {
+	.lessthan_fn = timeout_lessthan,
+};
+
+/* Never wraps in practice, zero is reserved for unqueued timeouts */
+static uint64_t next_order_key = 1U;
+
+static struct _timeout *first(void)
+{
+	struct rbnode *n = rb_get_min(&timeout_tree);
+
+	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
+}
+
+/* Ticks from curr_tick until the timeout expires */
+static k_ticks_t timeout_dticks(const struct _timeout *t)
+{
+	return (k_ticks_t)(t->expiry - curr_tick);
+}
+
+static void insert_timeout(struct _timeout *to)
+{
+	to->expiry = curr_tick + to->dticks;
+	to->order_key = next_order_key;
+	++next_order_key;
+
+	rb_insert(&timeout_tree, &to->node);
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	rb_remove(&timeout_tree, &t->node);
+	t->order_key = 0U;
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	return timeout_dticks(timeout);
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Ticks from curr_tick until the earliest end of a slack window, only
+ * the timeouts expiring before it can end their window earlier
+ */
+static int64_t slack_dticks(void)
+{
+	struct rbnode *n;
+	int64_t ret = INT64_MAX;
+
+	RB_FOR_EACH(&timeout_tree, n) {
+		struct _timeout *t = CONTAINER_OF(n, struct _timeout, node);
+		int64_t dticks = timeout_dticks(t);
+
+		if (dticks > ret) {
+			break;
+		}
+		ret = MIN(ret, dticks + t->slack);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+#else
+static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -51,6 +139,30 @@ static struct _timeout *next(struct _timeout *t)
 	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
+/* Ticks from curr_tick until the timeout expires, only valid for first() */
+static k_ticks_t timeout_dticks(const struct _timeout *t)
+{
+	return t->dticks;
+}
+
+static void insert_timeout(struct _timeout *to)
+{
+	struct _timeout *t;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+}
+
 static void remove_timeout(struct _timeout *t)
 {
 	if (next(t) != NULL) {
@@ -60,6 +172,43 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Ticks from curr_tick until the earliest end of a slack window, only
+ * the timeouts expiring before it can end their window earlier
+ */
+static int64_t slack_dticks(void)
+{
+	int64_t dticks = 0;
+	int64_t ret = INT64_MAX;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		dticks += t->dticks;
+		if (dticks > ret) {
+			break;
+		}
+		ret = MIN(ret, dticks + t->slack);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+#endif /* CONFIG_TIMEOUT_QUEUE_SCALABLE */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -81,21 +230,47 @@ static int32_t elapsed(void)
 	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
 }
 
-static int32_t next_timeout(int32_t ticks_elapsed)
+/* Ticks from curr_tick until the next wakeup, INT64_MAX if none.
+ *
+ * With slack, the wakeup is deferred as long as no timeout would expire
+ * after the end of its slack window, so that the timeouts expiring in
+ * the meantime are processed together.
+ */
+static int64_t wakeup_dticks(void)
 {
+#ifdef CONFIG_TIMEOUT_SLACK
+	return slack_dticks();
+#else
 	struct _timeout *to = first();
+
+	return (to == NULL) ? INT64_MAX : (int64_t)timeout_dticks(to);
+#endif /* CONFIG_TIMEOUT_SLACK */
+}
+
+static int32_t next_timeout(int32_t ticks_elapsed)
+{
+	int64_t dticks = wakeup_dticks();
 	int32_t ret;
 
-	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	if ((dticks == INT64_MAX) ||
+	    ((dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = SYS_CLOCK_MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, dticks - ticks_elapsed);
 	}
 
 	return ret;
 }
 
+/* Must be called with timeout_lock held */
+static void program_next_timeout(int32_t ticks_elapsed)
+{
+#ifdef CONFIG_TIMEOUT_STATS
+	timeout_stats.reprograms++;
+#endif /* CONFIG_TIMEOUT_STATS */
+	sys_clock_set_timeout(next_timeout(ticks_elapsed), false);
+}
+
 k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t timeout)
 {
 	k_ticks_t ticks = 0;
@@ -108,13 +283,21 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 	__ASSERT_NO_MSG(arch_mem_coherent(to));
 #endif /* CONFIG_KERNEL_COHERENCE */
 
-	__ASSERT(!sys_dnode_is_linked(&to->node), "");
+	__ASSERT(z_is_inactive_timeout(to), "");
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
 		int32_t ticks_elapsed;
 		bool has_elapsed = false;
+		bool reprogram;
+#ifdef CONFIG_TIMEOUT_SLACK
+		int64_t prev_wakeup = wakeup_dticks();
+
+		__ASSERT(timeout.slack != K_TICKS_FOREVER, "slack must be finite");
+		/* Absolute slacks make no sense, ignore them */
+		to->slack = Z_IS_TIMEOUT_RELATIVE(Z_TIMEOUT_TICKS(timeout.slack)) ?
+			    timeout.slack : 0;
+#endif /* CONFIG_TIMEOUT_SLACK */
 
 		if (Z_IS_TIMEOUT_RELATIVE(timeout)) {
 			ticks_elapsed = elapsed();
@@ -128,27 +311,25 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 			ticks = timeout.ticks;
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
+		insert_timeout(to);
 
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
+#ifdef CONFIG_TIMEOUT_SLACK
+		/* The timer only needs to fire earlier if the new timeout
+		 * ends the earliest slack window.
+		 */
+		reprogram = wakeup_dticks() < prev_wakeup;
+#else
+		reprogram = (to == first());
+#endif /* CONFIG_TIMEOUT_SLACK */
 
-		if (to == first() && announce_remaining == 0) {
+		if (reprogram && announce_remaining == 0) {
 			if (!has_elapsed) {
 				/* In case of absolute timeout that is first to expire
 				 * elapsed need to be read from the system clock.
 				 */
 				ticks_elapsed = elapsed();
 			}
-			sys_clock_set_timeout(next_timeout(ticks_elapsed), false);
+			program_next_timeout(ticks_elapsed);
 		}
 	}
 
@@ -160,14 +341,24 @@ int z_abort_timeout(struct _timeout *to)
 	int ret = -EINVAL;
 
 	K_SPINLOCK(&timeout_lock) {
-		if (sys_dnode_is_linked(&to->node)) {
+		if (!z_is_inactive_timeout(to)) {
+#ifdef CONFIG_TIMEOUT_SLACK
+			int64_t prev_wakeup = wakeup_dticks();
+#else
 			bool is_first = (to == first());
+#endif /* CONFIG_TIMEOUT_SLACK */
+			bool reprogram;
 
 			remove_timeout(to);
 			to->dticks = TIMEOUT_DTICKS_ABORTED;
 			ret = 0;
-			if (is_first) {
-				sys_clock_set_timeout(next_timeout(elapsed()), false);
+#ifdef CONFIG_TIMEOUT_SLACK
+			reprogram = wakeup_dticks() != prev_wakeup;
+#else
+			reprogram = is_first;
+#endif /* CONFIG_TIMEOUT_SLACK */
+			if (reprogram) {
+				program_next_timeout(elapsed());
 			}
 		}
 	}
@@ -175,21 +366,6 @@ int z_abort_timeout(struct _timeout *to)
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
-
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks;
-}
-
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
@@ -248,28 +424,48 @@ void sys_clock_announce(int32_t ticks)
 	struct _timeout *t;
 
 	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
+	     (t != NULL) && (timeout_dticks(t) <= announce_remaining);
 	     t = first()) {
-		int dt = t->dticks;
+		int dt = timeout_dticks(t);
 
 		curr_tick += dt;
 		t->dticks = 0;
 		remove_timeout(t);
 
+#ifdef CONFIG_TIMEOUT_SLACK
+		/* Record how late the timeout fires when its slack merged
+		 * its wakeup into that of a timeout expiring after it.
+		 */
+		if ((announce_remaining > dt) &&
+		    ((int64_t)(announce_remaining - dt) <= (int64_t)t->slack) &&
+		    (first() != NULL) &&
+		    ((int64_t)timeout_dticks(first()) <= (int64_t)(announce_remaining - dt))) {
+			t->dticks = dt - announce_remaining;
+#ifdef CONFIG_TIMEOUT_STATS
+			timeout_stats.coalesced++;
+#endif /* CONFIG_TIMEOUT_STATS */
+		}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 		k_spin_unlock(&timeout_lock, key);
 		t->fn(t);
 		key = k_spin_lock(&timeout_lock);
 		announce_remaining -= dt;
 	}
 
+#ifndef CONFIG_TIMEOUT_QUEUE_SCALABLE
+	/* Tree entries hold absolute expiries, only the list head is
+	 * relative to curr_tick and needs to follow it.
+	 */
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
 	}
+#endif /* CONFIG_TIMEOUT_QUEUE_SCALABLE */
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
 
-	sys_clock_set_timeout(next_timeout(0), false);
+	program_next_timeout(0);
 
 	k_spin_unlock(&timeout_lock, key);
 
@@ -347,10 +543,40 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 	return K_TICKS(remaining);
 }
 
+#ifdef CONFIG_TIMEOUT_STATS
+void sys_clock_timeout_stats_get(struct sys_clock_timeout_stats *stats)
+{
+	K_SPINLOCK(&timeout_lock) {
+		*stats = timeout_stats;
+	}
+}
+
+void sys_clock_timeout_stats_reset(void)
+{
+	K_SPINLOCK(&timeout_lock) {
+		timeout_stats.reprograms = 0U;
+		timeout_stats.coalesced = 0U;
+	}
+}
+#endif /* CONFIG_TIMEOUT_STATS */
+
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
-	curr_tick = tick;
+	K_SPINLOCK(&timeout_lock) {
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+		struct rbnode *n;
+
+		/* Expiries are absolute, keep the pending timeouts as far
+		 * from the new current tick as they were from the old one.
+		 * Shifting them all by the same amount keeps the tree sorted.
+		 */
+		RB_FOR_EACH(&timeout_tree, n) {
+			CONTAINER_OF(n, struct _timeout, node)->expiry += tick - curr_tick;
+		}
+#endif /* CONFIG_TIMEOUT_QUEUE_SCALABLE */
+		curr_tick = tick;
+	}
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
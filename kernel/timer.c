@@ -9,6 +9,7 @@
 #include <zephyr/init.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <stdbool.h>
+#include <string.h>
 #include <zephyr/spinlock.h>
 #include <ksched.h>
 #include <wait_q.h>
@@ -17,6 +18,49 @@ static struct k_spinlock lock;
 
 #ifdef CONFIG_OBJ_CORE_TIMER
 static struct k_obj_type obj_type_timer;
+
+#ifdef CONFIG_OBJ_CORE_STATS_TIMER
+static int k_timer_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_timer *timer;
+	k_spinlock_key_t key;
+
+	timer = CONTAINER_OF(obj_core, struct k_timer, obj_core);
+	key = k_spin_lock(&lock);
+	memcpy(stats, &timer->stats, sizeof(timer->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static int k_timer_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_timer *timer;
+	k_spinlock_key_t key;
+
+	timer = CONTAINER_OF(obj_core, struct k_timer, obj_core);
+	key = k_spin_lock(&lock);
+	timer->stats.expirations = 0U;
+	timer->stats.merged = 0U;
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc timer_stats_desc = {
+	.raw_size = sizeof(struct k_timer_stats),
+	.query_size = sizeof(struct k_timer_stats),
+	.raw   = k_timer_stats_raw,
+	.query = k_timer_stats_raw,
+	.reset = k_timer_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_TIMER */
 #endif /* CONFIG_OBJ_CORE_TIMER */
 
 /**
@@ -43,11 +87,20 @@ void z_timer_expiration_handler(struct _timeout *t)
 	 * was restarted, its expiration handler should not be executed then,
 	 * so the function exits immediately.
 	 */
-	if (sys_dnode_is_linked(&t->node)) {
+	if (!z_is_inactive_timeout(t)) {
 		k_spin_unlock(&lock, key);
 		return;
 	}
 
+#ifdef CONFIG_OBJ_CORE_STATS_TIMER
+	timer->stats.expirations++;
+#ifdef CONFIG_TIMEOUT_SLACK
+	if (z_is_merged_timeout(t)) {
+		timer->stats.merged++;
+	}
+#endif /* CONFIG_TIMEOUT_SLACK */
+#endif /* CONFIG_OBJ_CORE_STATS_TIMER */
+
 	/*
 	 * if the timer is periodic, start it again; don't add _TICK_ALIGN
 	 * since we're already aligned to a tick boundary
@@ -73,6 +126,10 @@ void z_timer_expiration_handler(struct _timeout *t)
 		 */
 		next = K_TIMEOUT_ABS_TICKS(k_uptime_ticks() + 1 + next.ticks);
 #endif /* CONFIG_TIMEOUT_64BIT */
+#ifdef CONFIG_TIMEOUT_SLACK
+		/* Each period keeps the slack it was started with */
+		next.slack = timer->period.slack;
+#endif /* CONFIG_TIMEOUT_SLACK */
 		z_add_timeout(&timer->timeout, z_timer_expiration_handler,
 			      next);
 	}
@@ -132,6 +189,12 @@ void k_timer_init(struct k_timer *timer,
 
 #ifdef CONFIG_OBJ_CORE_TIMER
 	k_obj_core_init_and_link(K_OBJ_CORE(timer), &obj_type_timer);
+#ifdef CONFIG_OBJ_CORE_STATS_TIMER
+	timer->stats.expirations = 0U;
+	timer->stats.merged = 0U;
+	k_obj_core_stats_register(K_OBJ_CORE(timer), &timer->stats,
+				  sizeof(struct k_timer_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_TIMER */
 #endif /* CONFIG_OBJ_CORE_TIMER */
 }
 
@@ -356,11 +419,18 @@ static int init_timer_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_timer, K_OBJ_TYPE_TIMER_ID,
 			offsetof(struct k_timer, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_TIMER
+	k_obj_type_stats_init(&obj_type_timer, &timer_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_TIMER */
 
 	/* Initialize and link statically defined timers */
 
 	STRUCT_SECTION_FOREACH(k_timer, timer) {
 		k_obj_core_init_and_link(K_OBJ_CORE(timer), &obj_type_timer);
+#ifdef CONFIG_OBJ_CORE_STATS_TIMER
+		k_obj_core_stats_register(K_OBJ_CORE(timer), &timer->stats,
+					  sizeof(struct k_timer_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_TIMER */
 	}
 
 	return 0;
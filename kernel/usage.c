@@ -10,6 +10,7 @@
 #include <ksched.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
+#include <string.h>
 
 /* Need one of these for this to work */
 #if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING)
@@ -96,6 +97,57 @@ void z_sched_usage_start(struct k_thread *thread)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY
+void z_sched_latency_ready(struct k_thread *thread)
+{
+	thread->base.latency.ready = usage_now();
+}
+
+static void sched_latency_record(struct k_latency_stats *latency, uint32_t cycles)
+{
+	uint32_t scaled = cycles >> CONFIG_SCHED_THREAD_LATENCY_SHIFT;
+	int bucket = (scaled == 0U) ? 0 : (LOG2(scaled) + 1);
+
+	latency->hist[MIN(bucket, CONFIG_SCHED_THREAD_LATENCY_BUCKETS - 1)]++;
+
+	if (latency->longest < cycles) {
+		latency->longest = cycles;
+	}
+}
+
+void z_sched_latency_switch(struct k_thread *old_thread,
+			    struct k_thread *new_thread)
+{
+	uint32_t now = usage_now();
+
+	/* A thread switched out while still ready was preempted (or
+	 * yielded), and waits to run again from now on.
+	 */
+	if ((old_thread != NULL) && !z_is_idle_thread_object(old_thread)) {
+		if (z_is_thread_ready(old_thread)) {
+			old_thread->base.latency.preemptions++;
+			old_thread->base.latency.ready = now;
+		} else {
+			old_thread->base.latency.ready = 0U;
+		}
+	}
+
+	if ((new_thread != NULL) && (new_thread->base.latency.ready != 0U)) {
+		sched_latency_record(&new_thread->base.latency,
+				     now - new_thread->base.latency.ready);
+		new_thread->base.latency.ready = 0U;
+	}
+}
+
+static void sched_latency_copy(const struct k_latency_stats *latency,
+			       struct k_thread_runtime_stats *stats)
+{
+	stats->preemptions = latency->preemptions;
+	stats->peak_latency_cycles = latency->longest;
+	memcpy(stats->latency_hist, latency->hist, sizeof(stats->latency_hist));
+}
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+
 void z_sched_usage_stop(void)
 {
 	k_spinlock_key_t k   = k_spin_lock(&usage_lock);
@@ -166,6 +218,12 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 
 	stats->execution_cycles = stats->total_cycles + stats->idle_cycles;
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY
+	stats->preemptions = 0U;
+	stats->peak_latency_cycles = 0U;
+	memset(stats->latency_hist, 0, sizeof(stats->latency_hist));
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+
 	k_spin_unlock(&usage_lock, key);
 }
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
@@ -221,6 +279,10 @@ void z_sched_thread_usage(struct k_thread *thread,
 	stats->idle_cycles = 0;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY
+	sched_latency_copy(&thread->base.latency, stats);
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+
 	k_spin_unlock(&usage_lock, key);
 }
 
@@ -383,6 +445,12 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY
+	thread->base.latency.preemptions = 0U;
+	thread->base.latency.longest = 0U;
+	memset(thread->base.latency.hist, 0, sizeof(thread->base.latency.hist));
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+
 	if (thread != _current_cpu->current) {
 
 		/*
@@ -95,6 +95,95 @@ static inline void init_work_cancel(struct z_work_canceller *canceler,
 	sys_slist_append(&pending_cancels, &canceler->node);
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+static inline bool queue_is_pool(const struct k_work_q *queue)
+{
+	return queue->workers != NULL;
+}
+
+/* Find the worker of a pool that is the current thread.
+ *
+ * @return the worker, or NULL if the current thread is not one of the
+ * workers of @p queue.
+ */
+static struct k_work_q_worker *current_worker(struct k_work_q *queue)
+{
+	if (!queue_is_pool(queue) || k_is_in_isr()) {
+		return NULL;
+	}
+
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		if (&queue->workers[i].thread == _current) {
+			return &queue->workers[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Find the worker of a pool that is running a work item.
+ *
+ * Invoked with work lock held.
+ *
+ * @return the worker, or NULL if @p work is not running on @p queue.
+ */
+static struct k_work_q_worker *running_worker_locked(struct k_work_q *queue,
+						     const struct k_work *work)
+{
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		if (queue->workers[i].work == work) {
+			return &queue->workers[i];
+		}
+	}
+
+	return NULL;
+}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+/* Find the list of pending items holding a queued work item.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue the work item is queued on.
+ * @param work the queued work item.
+ */
+static sys_slist_t *pending_list_locked(struct k_work_q *queue,
+					const struct k_work *work)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue_is_pool(queue)) {
+		for (size_t i = 0; i < queue->num_workers; i++) {
+			sys_slist_t *list = &queue->workers[i].pending;
+
+			if (sys_slist_find(list, &work->node, NULL)) {
+				return list;
+			}
+		}
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	return &queue->pending;
+}
+
+/* Check whether a queue has any pending item.
+ *
+ * Invoked with work lock held.
+ */
+static bool queue_has_pending_locked(const struct k_work_q *queue)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue_is_pool(queue)) {
+		for (size_t i = 0; i < queue->num_workers; i++) {
+			if (!sys_slist_is_empty(&queue->workers[i].pending)) {
+				return true;
+			}
+		}
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	return !sys_slist_is_empty(&queue->pending);
+}
+
 /* Complete flushing of a work item.
  *
  * Invoked with work lock held.
@@ -194,10 +283,24 @@ static void queue_flusher_locked(struct k_work_q *queue,
 	init_flusher(flusher);
 
 	if ((flags_get(&work->flags) & K_WORK_QUEUED) != 0U) {
-		sys_slist_insert(&queue->pending, &work->node,
+		sys_slist_insert(pending_list_locked(queue, work), &work->node,
 				 &flusher->work.node);
 	} else {
-		sys_slist_prepend(&queue->pending, &flusher->work.node);
+		sys_slist_t *pending = &queue->pending;
+
+#if defined(CONFIG_WORKQUEUE_POOL)
+		/* In a pool the flusher must run after the item, on the
+		 * worker that is running it.
+		 */
+		if (queue_is_pool(queue)) {
+			struct k_work_q_worker *worker = running_worker_locked(queue, work);
+
+			__ASSERT_NO_MSG(worker != NULL);
+			pending = &worker->pending;
+		}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+		sys_slist_prepend(pending, &flusher->work.node);
 	}
 }
 
@@ -212,7 +315,8 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 				       struct k_work *work)
 {
 	if (flag_test_and_clear(&work->flags, K_WORK_QUEUED_BIT)) {
-		(void)sys_slist_find_and_remove(&queue->pending, &work->node);
+		(void)sys_slist_find_and_remove(pending_list_locked(queue, work),
+						&work->node);
 	}
 }
 
@@ -238,6 +342,48 @@ static inline bool notify_queue_locked(struct k_work_q *queue)
 	return rv;
 }
 
+/* Add a work item to the pending items of a queue and notify it.
+ *
+ * In a pool an item that is still running goes to the worker running it,
+ * so that it cannot run twice at the same time, and an item chained by a
+ * worker stays with that worker unless an idle worker steals it.
+ *
+ * Invoked with work lock held.
+ * Conditionally notifies queue.
+ *
+ * @param queue the queue to which work is added.
+ * @param work the work item to add.
+ */
+static void queue_append_locked(struct k_work_q *queue,
+				struct k_work *work)
+{
+	sys_slist_t *pending = &queue->pending;
+
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue_is_pool(queue)) {
+		struct k_work_q_worker *worker;
+
+		if (flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+			/* The worker picks it up when the handler returns, no
+			 * other worker can take it before.
+			 */
+			worker = running_worker_locked(queue, work);
+			__ASSERT_NO_MSG(worker != NULL);
+			sys_slist_append(&worker->pending, &work->node);
+			return;
+		}
+
+		worker = current_worker(queue);
+		if (worker != NULL) {
+			pending = &worker->pending;
+		}
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	sys_slist_append(pending, &work->node);
+	(void)notify_queue_locked(queue);
+}
+
 /* Submit an work item to a queue if queue state allows new work.
  *
  * Submission is rejected if no queue is provided, or if the queue is
@@ -269,6 +415,12 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue_is_pool(queue)) {
+		chained = (current_worker(queue) != NULL);
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
 	/* Test for acceptability, in priority order:
 	 *
 	 * * -ENODEV if the queue isn't running.
@@ -283,9 +435,8 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	} else if (plugged && !draining) {
 		ret = -EBUSY;
 	} else {
-		sys_slist_append(&queue->pending, &work->node);
+		queue_append_locked(queue, work);
 		ret = 1;
-		(void)notify_queue_locked(queue);
 	}
 
 	return ret;
@@ -648,16 +799,118 @@ static void work_timeout_stop_locked(struct k_work_q *queue)
 }
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+/* Move the flushers that followed a work item taken from a list to the
+ * front of the pending items of the worker that took it.
+ *
+ * Invoked with work lock held.
+ *
+ * @param worker the worker that took the item
+ * @param list the list the item was taken from
+ * @param prev the node that preceded the item in @p list, or NULL
+ */
+static void take_flushers_locked(struct k_work_q_worker *worker,
+				 sys_slist_t *list, sys_snode_t *prev)
+{
+	sys_snode_t *last = NULL;
+	sys_snode_t *node;
+
+	while (true) {
+		node = (prev != NULL) ? sys_slist_peek_next(prev) : sys_slist_peek_head(list);
+		if ((node == NULL) ||
+		    !flag_test(&CONTAINER_OF(node, struct k_work, node)->flags,
+			       K_WORK_FLUSHING_BIT)) {
+			break;
+		}
+
+		sys_slist_remove(list, prev, node);
+		sys_slist_insert(&worker->pending, last, node);
+		last = node;
+	}
+}
+
+/* Take the next work item for a worker of a pool.
+ *
+ * A worker first takes its own items, then the shared ones, and then steals
+ * from the other workers the first item that neither runs on them nor is a
+ * flusher.  The flushers that follow the taken item move with it, so that
+ * they complete only after it has run.
+ *
+ * Invoked with work lock held.
+ *
+ * @param worker the worker looking for work
+ *
+ * @return the node of the taken work item, or NULL if there is none.
+ */
+static sys_snode_t *pool_take_locked(struct k_work_q_worker *worker)
+{
+	struct k_work_q *queue = worker->queue;
+	size_t self = worker - queue->workers;
+	sys_snode_t *node = sys_slist_get(&worker->pending);
+
+	if (node == NULL) {
+		node = sys_slist_get(&queue->pending);
+		if (node != NULL) {
+			take_flushers_locked(worker, &queue->pending, NULL);
+		}
+	}
+
+	for (size_t i = 1; (node == NULL) && (i < queue->num_workers); i++) {
+		sys_slist_t *victim = &queue->workers[(self + i) % queue->num_workers].pending;
+		sys_snode_t *prev = NULL;
+
+		SYS_SLIST_FOR_EACH_NODE(victim, node) {
+			struct k_work *work = CONTAINER_OF(node, struct k_work, node);
+
+			if ((flags_get(&work->flags) & (K_WORK_RUNNING | K_WORK_FLUSHING)) == 0U) {
+				break;
+			}
+			prev = node;
+		}
+
+		if (node != NULL) {
+			sys_slist_remove(victim, prev, node);
+			take_flushers_locked(worker, victim, prev);
+		}
+	}
+
+	return node;
+}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+/* Check whether a queue has neither pending nor running work items.
+ *
+ * Invoked with work lock held, by a work queue thread that found no work.
+ */
+static inline bool queue_is_idle_locked(const struct k_work_q *queue)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue_is_pool(queue)) {
+		return (queue->num_busy == 0U) && !queue_has_pending_locked(queue);
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	ARG_UNUSED(queue);
+
+	return true;
+}
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
+ * @param worker_ptr pointer to the worker structure of a pool thread, or
+ * NULL
  */
-static void work_queue_main(void *workq_ptr, void *p2, void *p3)
+static void work_queue_main(void *workq_ptr, void *worker_ptr, void *p3)
 {
-	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
 	struct k_work_q *queue = (struct k_work_q *)workq_ptr;
+#if defined(CONFIG_WORKQUEUE_POOL)
+	struct k_work_q_worker *worker = (struct k_work_q_worker *)worker_ptr;
+#else
+	ARG_UNUSED(worker_ptr);
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 
 	while (true) {
 		sys_snode_t *node;
@@ -667,7 +920,12 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		bool yield;
 
 		/* Check for and prepare any new work. */
+#if defined(CONFIG_WORKQUEUE_POOL)
+		node = (worker != NULL) ? pool_take_locked(worker)
+					: sys_slist_get(&queue->pending);
+#else
 		node = sys_slist_get(&queue->pending);
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
@@ -690,7 +948,14 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * This means that if node is not NULL, then work will not be NULL.
 			 */
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
+#if defined(CONFIG_WORKQUEUE_POOL)
+			if (worker != NULL) {
+				worker->work = work;
+				queue->num_busy++;
+			}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+		} else if (queue_is_idle_locked(queue) &&
+			   flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
@@ -700,11 +965,21 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * We don't touch K_WORK_QUEUE_PLUGGABLE, so getting
 			 * here doesn't mean that the queue will allow new
 			 * submissions.
+			 *
+			 * In a pool only the last worker to become idle gets
+			 * here.
 			 */
 			(void)z_sched_wake_all(&queue->drainq, 1, NULL);
 		} else if (flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
 			/* User has requested that the queue stop. Clear the status flags and exit.
 			 */
+#if defined(CONFIG_WORKQUEUE_POOL)
+			/* The last worker of a pool to exit clears them. */
+			if ((worker != NULL) && (--queue->num_alive > 0U)) {
+				k_spin_unlock(&lock, key);
+				return;
+			}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 			flags_set(&queue->flags, 0);
 			k_spin_unlock(&lock, key);
 			return;
@@ -755,7 +1030,16 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
-		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#if defined(CONFIG_WORKQUEUE_POOL)
+		if (worker != NULL) {
+			worker->work = NULL;
+			queue->num_busy--;
+		}
+		if (queue->num_busy == 0U)
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+		{
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -804,6 +1088,9 @@ void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+#if defined(CONFIG_WORKQUEUE_POOL)
+	queue->workers = NULL;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 	queue->thread_id = _current;
 	flags_set(&queue->flags, flags);
 	work_queue_main(queue, NULL, NULL);
@@ -826,6 +1113,9 @@ void k_work_queue_start(struct k_work_q *queue,
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+#if defined(CONFIG_WORKQUEUE_POOL)
+	queue->workers = NULL;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 
 	if ((cfg != NULL) && cfg->no_yield) {
 		flags |= K_WORK_QUEUE_NO_YIELD;
@@ -863,6 +1153,82 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+void k_work_queue_start_pool(struct k_work_q *queue,
+			     struct k_work_q_worker *workers, size_t num_workers,
+			     k_thread_stack_t *stacks, size_t stack_size,
+			     int prio, const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(workers);
+	__ASSERT_NO_MSG(stacks);
+	__ASSERT_NO_MSG((num_workers > 0U) && (num_workers <= UINT16_MAX));
+	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+	__ASSERT((cfg == NULL) || (cfg->work_timeout_ms == 0U),
+		 "work timeout is not supported by work queue pools");
+
+	uint32_t flags = K_WORK_QUEUE_STARTED;
+	size_t stride = K_THREAD_STACK_LEN(stack_size);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+	sys_slist_init(&queue->pending);
+	z_waitq_init(&queue->notifyq);
+	z_waitq_init(&queue->drainq);
+
+	if ((cfg != NULL) && cfg->no_yield) {
+		flags |= K_WORK_QUEUE_NO_YIELD;
+	}
+
+	queue->workers = workers;
+	queue->num_workers = (uint16_t)num_workers;
+	queue->num_busy = 0U;
+	queue->num_alive = (uint16_t)num_workers;
+
+#if defined(CONFIG_WORKQUEUE_WORK_TIMEOUT)
+	queue->work_timeout = K_FOREVER;
+#endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
+
+	for (size_t i = 0; i < num_workers; i++) {
+		struct k_work_q_worker *worker = &workers[i];
+
+		worker->queue = queue;
+		worker->work = NULL;
+		sys_slist_init(&worker->pending);
+
+		(void)k_thread_create(&worker->thread, &stacks[i * stride], stack_size,
+				      work_queue_main, queue, worker, NULL,
+				      prio, 0, K_FOREVER);
+
+		if ((cfg != NULL) && (cfg->name != NULL)) {
+			k_thread_name_set(&worker->thread, cfg->name);
+		}
+
+		if ((cfg != NULL) && (cfg->essential)) {
+			worker->thread.base.user_options |= K_ESSENTIAL;
+		}
+
+#if defined(CONFIG_SCHED_CPU_MASK)
+		if ((cfg != NULL) && cfg->pin_workers) {
+			(void)k_thread_cpu_pin(&worker->thread, i % arch_num_cpus());
+		}
+#endif /* defined(CONFIG_SCHED_CPU_MASK) */
+	}
+
+	/* As for a single thread queue, submissions are accepted from now on
+	 * and wait for the workers to get control.
+	 */
+	flags_set(&queue->flags, flags);
+	queue->thread_id = &workers[0].thread;
+
+	for (size_t i = 0; i < num_workers; i++) {
+		k_thread_start(&workers[i].thread);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
+}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -877,7 +1243,7 @@ int k_work_queue_drain(struct k_work_q *queue,
 	if (((flags_get(&queue->flags)
 	      & (K_WORK_QUEUE_BUSY | K_WORK_QUEUE_DRAIN)) != 0U)
 	    || plug
-	    || !sys_slist_is_empty(&queue->pending)) {
+	    || queue_has_pending_locked(queue)) {
 		flag_set(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 		if (plug) {
 			flag_set(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
@@ -915,6 +1281,30 @@ int k_work_queue_unplug(struct k_work_q *queue)
 	return ret;
 }
 
+/* Wait for the threads of a stopping queue to exit.
+ *
+ * @return 0 once all of them exited, or the error of the first
+ * k_thread_join() that failed
+ */
+static int queue_join(struct k_work_q *queue, k_timeout_t timeout)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue_is_pool(queue)) {
+		k_timepoint_t end = sys_timepoint_calc(timeout);
+		int ret = 0;
+
+		for (size_t i = 0; (ret == 0) && (i < queue->num_workers); i++) {
+			ret = k_thread_join(&queue->workers[i].thread,
+					    sys_timepoint_timeout(end));
+		}
+
+		return ret;
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	return k_thread_join(queue->thread_id, timeout);
+}
+
 int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 {
 	__ASSERT_NO_MSG(queue);
@@ -936,9 +1326,14 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 
 	flag_set(&queue->flags, K_WORK_QUEUE_STOP_BIT);
 	notify_queue_locked(queue);
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue_is_pool(queue)) {
+		(void)z_sched_wake_all(&queue->notifyq, 0, NULL);
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 	k_spin_unlock(&lock, key);
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work_queue, stop, queue, timeout);
-	if (k_thread_join(queue->thread_id, timeout)) {
+	if (queue_join(queue, timeout) != 0) {
 		key = k_spin_lock(&lock);
 		flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
 		k_spin_unlock(&lock, key);
@@ -21,33 +21,35 @@ static inline void increase_allocated_bytes(struct z_heap *h, size_t num_bytes)
 }
 #endif
 
-static void *chunk_mem(struct z_heap *h, chunkid_t c)
+static void free_list_set_avail(struct z_heap *h, int lidx, bool avail)
 {
-	chunk_unit_t *buf = chunk_buf(h);
-	uint8_t *ret = ((uint8_t *)&buf[c]) + chunk_header_bytes(h);
+#ifdef CONFIG_SYS_HEAP_TLSF
+	struct z_heap_bucket *b = &h->buckets[lidx >> FREE_LIST_BITS];
 
-	CHECK(!(((uintptr_t)ret) & (big_heap(h) ? 7 : 3)));
-
-	return ret;
+	WRITE_BIT(b->avail_lists, lidx & BIT_MASK(FREE_LIST_BITS), avail);
+	WRITE_BIT(h->avail_buckets, lidx >> FREE_LIST_BITS, b->avail_lists != 0U);
+#else
+	WRITE_BIT(h->avail_buckets, lidx, avail);
+#endif
 }
 
 static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int bidx)
 {
-	struct z_heap_bucket *b = &h->buckets[bidx];
+	chunkid_t *head = free_list_head(h, bidx);
 
 	CHECK(!chunk_used(h, c));
-	CHECK(b->next != 0);
-	CHECK(h->avail_buckets & BIT(bidx));
+	CHECK(*head != 0);
+	CHECK(free_list_avail(h, bidx));
 
 	if (next_free_chunk(h, c) == c) {
 		/* this is the last chunk */
-		h->avail_buckets &= ~BIT(bidx);
-		b->next = 0;
+		free_list_set_avail(h, bidx, false);
+		*head = 0;
 	} else {
 		chunkid_t first = prev_free_chunk(h, c),
 			  second = next_free_chunk(h, c);
 
-		b->next = second;
+		*head = second;
 		set_next_free_chunk(h, first, second);
 		set_prev_free_chunk(h, second, first);
 	}
@@ -60,28 +62,28 @@ static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int bidx)
 static void free_list_remove(struct z_heap *h, chunkid_t c)
 {
 	if (!solo_free_header(h, c)) {
-		int bidx = bucket_idx(h, chunk_size(h, c));
+		int bidx = free_list_idx(h, chunk_size(h, c));
 		free_list_remove_bidx(h, c, bidx);
 	}
 }
 
 static void free_list_add_bidx(struct z_heap *h, chunkid_t c, int bidx)
 {
-	struct z_heap_bucket *b = &h->buckets[bidx];
+	chunkid_t *head = free_list_head(h, bidx);
 
-	if (b->next == 0U) {
-		CHECK((h->avail_buckets & BIT(bidx)) == 0);
+	if (*head == 0U) {
+		CHECK(!free_list_avail(h, bidx));
 
 		/* Empty list, first item */
-		h->avail_buckets |= BIT(bidx);
-		b->next = c;
+		free_list_set_avail(h, bidx, true);
+		*head = c;
 		set_prev_free_chunk(h, c, c);
 		set_next_free_chunk(h, c, c);
 	} else {
-		CHECK(h->avail_buckets & BIT(bidx));
+		CHECK(free_list_avail(h, bidx));
 
 		/* Insert before (!) the "next" pointer */
-		chunkid_t second = b->next;
+		chunkid_t second = *head;
 		chunkid_t first = prev_free_chunk(h, second);
 
 		set_prev_free_chunk(h, c, first);
@@ -98,7 +100,7 @@ static void free_list_add_bidx(struct z_heap *h, chunkid_t c, int bidx)
 static void free_list_add(struct z_heap *h, chunkid_t c)
 {
 	if (!solo_free_header(h, c)) {
-		int bidx = bucket_idx(h, chunk_size(h, c));
+		int bidx = free_list_idx(h, chunk_size(h, c));
 		free_list_add_bidx(h, c, bidx);
 	}
 }
@@ -148,16 +150,14 @@ static void free_chunk(struct z_heap *h, chunkid_t c)
 	free_list_add(h, c);
 }
 
-/*
- * Return the closest chunk ID corresponding to given memory pointer.
- * Here "closest" is only meaningful in the context of sys_heap_aligned_alloc()
- * where wanted alignment might not always correspond to a chunk header
- * boundary.
- */
-static chunkid_t mem_to_chunkid(struct z_heap *h, void *p)
+void z_heap_free_chunk(struct z_heap *h, chunkid_t c)
 {
-	uint8_t *mem = p, *base = (uint8_t *)chunk_buf(h);
-	return (mem - chunk_header_bytes(h) - base) / CHUNK_UNIT;
+	set_chunk_used(h, c, false);
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
+#endif
+
+	free_chunk(h, c);
 }
 
 void sys_heap_free(struct sys_heap *heap, void *mem)
@@ -184,17 +184,12 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
-	set_chunk_used(h, c, false);
-#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
-	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
-#endif
-
 #ifdef CONFIG_SYS_HEAP_LISTENER
 	heap_listener_notify_free(HEAP_ID_FROM_POINTER(heap), mem,
 				  chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
-	free_chunk(h, c);
+	z_heap_free_chunk(h, c);
 }
 
 size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
@@ -208,7 +203,62 @@ size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
 	return chunk_sz - (addr - chunk_base);
 }
 
-static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
+#ifdef CONFIG_SYS_HEAP_TLSF
+/* Takes the first chunk of the smallest non-empty free list whose
+ * chunks are all large enough, found with one lookup in the list
+ * bitmap of the bucket and one in the bitmap of the buckets.  Failing
+ * that, the first chunk of the list the size belongs to is taken if it
+ * fits, so that the last chunks slightly larger than the request can
+ * still be used.
+ */
+static chunkid_t find_chunk(struct z_heap *h, chunksz_t sz)
+{
+	int lidx = free_list_idx(h, sz);
+	int bidx = lidx >> FREE_LIST_BITS;
+	uint32_t lmask = 0U;
+	chunkid_t c;
+
+	CHECK(bidx <= bucket_idx(h, h->end_chunk));
+
+	/* round up to the next list unless all chunks of this one fit */
+	if (free_list_min_size(h, lidx) < sz) {
+		lidx++;
+		bidx = lidx >> FREE_LIST_BITS;
+	}
+
+	if ((h->avail_buckets & BIT(bidx)) != 0U) {
+		lmask = h->buckets[bidx].avail_lists &
+			~BIT_MASK(lidx & BIT_MASK(FREE_LIST_BITS));
+	}
+
+	if (lmask == 0U) {
+		uint32_t bmask = h->avail_buckets & ~BIT_MASK(bidx + 1);
+
+		if (bmask != 0U) {
+			bidx = __builtin_ctz(bmask);
+			lmask = h->buckets[bidx].avail_lists;
+		}
+	}
+
+	if (lmask != 0U) {
+		lidx = (bidx << FREE_LIST_BITS) | __builtin_ctz(lmask);
+		c = *free_list_head(h, lidx);
+		free_list_remove_bidx(h, c, lidx);
+		CHECK(chunk_size(h, c) >= sz);
+		return c;
+	}
+
+	lidx = free_list_idx(h, sz);
+	c = *free_list_head(h, lidx);
+	if ((c != 0U) && (chunk_size(h, c) >= sz)) {
+		free_list_remove_bidx(h, c, lidx);
+		return c;
+	}
+
+	return 0;
+}
+#else
+static chunkid_t find_chunk(struct z_heap *h, chunksz_t sz)
 {
 	int bi = bucket_idx(h, sz);
 	struct z_heap_bucket *b = &h->buckets[bi];
@@ -259,6 +309,21 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 
 	return 0;
 }
+#endif /* CONFIG_SYS_HEAP_TLSF */
+
+static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
+{
+	chunkid_t c = find_chunk(h, sz);
+
+#ifdef CONFIG_SYS_HEAP_CACHE
+	/* Give the cached chunks back to the heap and try again */
+	if ((c == 0U) && z_heap_cache_flush(h)) {
+		c = find_chunk(h, sz);
+	}
+#endif
+
+	return c;
+}
 
 void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 {
@@ -557,6 +622,11 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	h->max_allocated_bytes = 0;
 #endif
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+	atomic_clear(&h->cache_disabled);
+	(void)memset(h->cache, 0, sizeof(h->cache));
+#endif
+
 #if CONFIG_SYS_HEAP_ARRAY_SIZE
 	sys_heap_array_save(heap);
 #endif
@@ -567,9 +637,7 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 
 	__ASSERT(chunk0_size + min_chunk_size(h) <= heap_sz, "heap size is too small");
 
-	for (int i = 0; i < nb_buckets; i++) {
-		h->buckets[i].next = 0;
-	}
+	(void)memset(h->buckets, 0, nb_buckets * sizeof(struct z_heap_bucket));
 
 	/* chunk containing our struct z_heap */
 	set_chunk_size(h, 0, chunk0_size);
@@ -61,10 +61,37 @@ typedef struct { char bytes[CHUNK_UNIT]; } chunk_unit_t;
 typedef uint32_t chunkid_t;
 typedef uint32_t chunksz_t;
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+/* Number of free lists per bucket, see free_list_idx() */
+#define FREE_LIST_BITS CONFIG_SYS_HEAP_TLSF_SL_BITS
+#else
+#define FREE_LIST_BITS 0
+#endif
+
+#define FREE_LISTS_PER_BUCKET BIT(FREE_LIST_BITS)
+
 struct z_heap_bucket {
+#ifdef CONFIG_SYS_HEAP_TLSF
+	uint32_t avail_lists;
+	chunkid_t next[FREE_LISTS_PER_BUCKET];
+#else
 	chunkid_t next;
+#endif
 };
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+/* Per-CPU lists of cached chunks, one per chunk size.  Cached chunks
+ * stay marked as used in the heap and are linked through their
+ * FREE_NEXT field.
+ */
+struct z_heap_cache {
+	struct k_spinlock lock;
+	size_t bytes;
+	chunkid_t head[CONFIG_SYS_HEAP_CACHE_CLASSES];
+	uint8_t count[CONFIG_SYS_HEAP_CACHE_CLASSES];
+};
+#endif
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
@@ -73,6 +100,11 @@ struct z_heap {
 	size_t free_bytes;
 	size_t allocated_bytes;
 	size_t max_allocated_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_CACHE
+	/* nonzero while chunks must not be cached */
+	atomic_t cache_disabled;
+	struct z_heap_cache cache[CONFIG_MP_MAX_NUM_CPUS];
 #endif
 	struct z_heap_bucket buckets[];
 };
@@ -264,6 +296,117 @@ static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
 	return 31 - __builtin_clz(usable_sz);
 }
 
+/* Index of the free list holding chunks of a given size.  Without
+ * CONFIG_SYS_HEAP_TLSF there is a single list per bucket.  Otherwise
+ * every bucket is split into FREE_LISTS_PER_BUCKET lists of evenly
+ * spaced sizes, indexed by the FREE_LIST_BITS bits following the top
+ * bit of the usable size.  The smallest buckets have fewer sizes than
+ * lists and get one list per size.
+ */
+static inline int free_list_idx(struct z_heap *h, chunksz_t sz)
+{
+	int bidx = bucket_idx(h, sz);
+
+#ifdef CONFIG_SYS_HEAP_TLSF
+	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
+	unsigned int sub;
+
+	if (bidx < FREE_LIST_BITS) {
+		sub = usable_sz - BIT(bidx);
+	} else {
+		sub = (usable_sz >> (bidx - FREE_LIST_BITS)) - FREE_LISTS_PER_BUCKET;
+	}
+
+	return (bidx << FREE_LIST_BITS) | sub;
+#else
+	return bidx;
+#endif
+}
+
+/* Number of free lists of the heap */
+static inline int nb_free_lists(struct z_heap *h)
+{
+	return (bucket_idx(h, h->end_chunk) + 1) << FREE_LIST_BITS;
+}
+
+static inline chunkid_t *free_list_head(struct z_heap *h, int lidx)
+{
+#ifdef CONFIG_SYS_HEAP_TLSF
+	return &h->buckets[lidx >> FREE_LIST_BITS].next[lidx & BIT_MASK(FREE_LIST_BITS)];
+#else
+	return &h->buckets[lidx].next;
+#endif
+}
+
+/* Whether the free list is marked as non-empty */
+static inline bool free_list_avail(struct z_heap *h, int lidx)
+{
+#ifdef CONFIG_SYS_HEAP_TLSF
+	return (h->buckets[lidx >> FREE_LIST_BITS].avail_lists &
+		BIT(lidx & BIT_MASK(FREE_LIST_BITS))) != 0U;
+#else
+	return (h->avail_buckets & BIT(lidx)) != 0U;
+#endif
+}
+
+/* Smallest chunk size held by a free list */
+static inline chunksz_t free_list_min_size(struct z_heap *h, int lidx)
+{
+	int bidx = lidx >> FREE_LIST_BITS;
+	unsigned int sub = lidx & BIT_MASK(FREE_LIST_BITS);
+	unsigned int usable_sz;
+
+	if (bidx < FREE_LIST_BITS) {
+		usable_sz = BIT(bidx) + sub;
+	} else {
+		usable_sz = (FREE_LISTS_PER_BUCKET + sub) << (bidx - FREE_LIST_BITS);
+	}
+
+	return usable_sz - 1 + min_chunk_size(h);
+}
+
+static inline void *chunk_mem(struct z_heap *h, chunkid_t c)
+{
+	chunk_unit_t *buf = chunk_buf(h);
+	uint8_t *ret = ((uint8_t *)&buf[c]) + chunk_header_bytes(h);
+
+	CHECK(!(((uintptr_t)ret) & (big_heap(h) ? 7 : 3)));
+
+	return ret;
+}
+
+/*
+ * Return the closest chunk ID corresponding to given memory pointer.
+ * Here "closest" is only meaningful in the context of sys_heap_aligned_alloc()
+ * where wanted alignment might not always correspond to a chunk header
+ * boundary.
+ */
+static inline chunkid_t mem_to_chunkid(struct z_heap *h, void *p)
+{
+	uint8_t *mem = p, *base = (uint8_t *)chunk_buf(h);
+	return (mem - chunk_header_bytes(h) - base) / CHUNK_UNIT;
+}
+
+/* Returns a used chunk to the heap without notifying heap listeners */
+void z_heap_free_chunk(struct z_heap *h, chunkid_t c);
+
+#ifdef CONFIG_SYS_HEAP_CACHE
+/* Returns all cached chunks to the heap, true if there were any */
+bool z_heap_cache_flush(struct z_heap *h);
+
+/* Number of bytes held in the caches */
+static inline size_t cached_bytes(struct z_heap *h)
+{
+	size_t bytes = 0;
+
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		bytes += h->cache[i].bytes;
+	}
+
+	return bytes;
+}
+#endif
+
 static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			   size_t *free_bytes)
 {
@@ -279,6 +422,14 @@ static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			*free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
 		}
 	}
+
+#ifdef CONFIG_SYS_HEAP_CACHE
+	/* cached chunks are marked used but are free for the user */
+	size_t cached = cached_bytes(h);
+
+	*alloc_bytes -= cached;
+	*free_bytes += cached;
+#endif
 }
 
 #endif /* ZEPHYR_INCLUDE_LIB_OS_HEAP_H_ */
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/heap_listener.h>
+#include <zephyr/kernel.h>
+#include "heap.h"
+#ifdef CONFIG_MSAN
+#include <sanitizer/msan_interface.h>
+#endif
+
+/*
+ * Per-CPU caches of small chunks.  Each CPU keeps one list per chunk
+ * size, from the minimum chunk size of the heap upwards, and only
+ * chunks of exactly the requested size are handed out again.  Cached
+ * chunks remain marked as used, so the heap never merges them and the
+ * only heap metadata touched without the heap's lock is the FREE_NEXT
+ * field of chunks owned by the cache.  The heap gets them back when
+ * an allocation cannot be satisfied otherwise.
+ */
+
+BUILD_ASSERT(sizeof(struct z_heap) - offsetof(struct z_heap, cache_disabled) <=
+	     Z_HEAP_CACHE_SIZE, "Z_HEAP_CACHE_SIZE is too small");
+
+static int cache_class(struct z_heap *h, chunksz_t sz)
+{
+	chunksz_t class = sz - min_chunk_size(h);
+
+	return (class < CONFIG_SYS_HEAP_CACHE_CLASSES) ? (int)class : -1;
+}
+
+void *sys_heap_cache_alloc(struct sys_heap *heap, size_t bytes)
+{
+	struct z_heap *h = heap->heap;
+	struct z_heap_cache *cache;
+	k_spinlock_key_t key;
+	unsigned int irq;
+	chunkid_t c;
+	int class;
+
+	if (bytes == 0U) {
+		return NULL;
+	}
+
+	class = cache_class(h, bytes_to_chunksz(h, bytes, 0));
+	if (class < 0) {
+		return NULL;
+	}
+
+	/* stay on this CPU until its cache is locked */
+	irq = arch_irq_lock();
+	cache = &h->cache[_current_cpu->id];
+	key = k_spin_lock(&cache->lock);
+
+	c = cache->head[class];
+	if (c != 0U) {
+		cache->head[class] = next_free_chunk(h, c);
+		cache->count[class]--;
+		cache->bytes -= chunksz_to_bytes(h, chunk_size(h, c));
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq);
+
+	if (c == 0U) {
+		return NULL;
+	}
+
+#ifdef CONFIG_SYS_HEAP_LISTENER
+	heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(heap), chunk_mem(h, c),
+				   chunksz_to_bytes(h, chunk_size(h, c)));
+#endif
+
+	IF_ENABLED(CONFIG_MSAN, (__msan_allocated_memory(chunk_mem(h, c), bytes)));
+	return chunk_mem(h, c);
+}
+
+bool sys_heap_cache_free(struct sys_heap *heap, void *mem)
+{
+	struct z_heap *h = heap->heap;
+	struct z_heap_cache *cache;
+	k_spinlock_key_t key;
+	unsigned int irq;
+	bool cached = false;
+	chunkid_t c;
+	int class;
+
+	if (mem == NULL) {
+		return true;
+	}
+
+	c = mem_to_chunkid(h, mem);
+
+	/* aligned allocations do not start at the beginning of the chunk */
+	if (chunk_mem(h, c) != mem) {
+		return false;
+	}
+
+	__ASSERT(chunk_used(h, c),
+		 "unexpected heap state (double-free?) for memory at %p", mem);
+	__ASSERT(left_chunk(h, right_chunk(h, c)) == c,
+		 "corrupted heap bounds (buffer overflow?) for memory at %p",
+		 mem);
+
+	class = cache_class(h, chunk_size(h, c));
+	if (class < 0) {
+		return false;
+	}
+
+	irq = arch_irq_lock();
+	cache = &h->cache[_current_cpu->id];
+	key = k_spin_lock(&cache->lock);
+
+	if ((atomic_get(&h->cache_disabled) == 0) &&
+	    (cache->count[class] < CONFIG_SYS_HEAP_CACHE_DEPTH)) {
+		set_next_free_chunk(h, c, cache->head[class]);
+		cache->head[class] = c;
+		cache->count[class]++;
+		cache->bytes += chunksz_to_bytes(h, chunk_size(h, c));
+		cached = true;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq);
+
+#ifdef CONFIG_SYS_HEAP_LISTENER
+	if (cached) {
+		heap_listener_notify_free(HEAP_ID_FROM_POINTER(heap), mem,
+					  chunksz_to_bytes(h, chunk_size(h, c)));
+	}
+#endif
+
+	return cached;
+}
+
+bool z_heap_cache_flush(struct z_heap *h)
+{
+	bool flushed = false;
+
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct z_heap_cache *cache = &h->cache[i];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+		for (int class = 0; class < CONFIG_SYS_HEAP_CACHE_CLASSES; class++) {
+			chunkid_t c = cache->head[class];
+
+			while (c != 0U) {
+				chunkid_t next = next_free_chunk(h, c);
+
+				z_heap_free_chunk(h, c);
+				c = next;
+				flushed = true;
+			}
+
+			cache->head[class] = 0;
+			cache->count[class] = 0;
+		}
+		cache->bytes = 0;
+
+		k_spin_unlock(&cache->lock, key);
+	}
+
+	return flushed;
+}
+
+void sys_heap_cache_flush(struct sys_heap *heap)
+{
+	(void)z_heap_cache_flush(heap->heap);
+}
+
+void sys_heap_cache_disable(struct sys_heap *heap)
+{
+	atomic_inc(&heap->heap->cache_disabled);
+}
+
+void sys_heap_cache_enable(struct sys_heap *heap)
+{
+	atomic_dec(&heap->heap->cache_disabled);
+}
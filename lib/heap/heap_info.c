@@ -22,8 +22,8 @@ static void heap_print_info(struct z_heap *h, bool dump_chunks)
 	printk("  bucket#    min units        total      largest      largest\n"
 	       "             threshold       chunks      (units)      (bytes)\n"
 	       "  -----------------------------------------------------------\n");
-	for (i = 0; i < nb_buckets; i++) {
-		chunkid_t first = h->buckets[i].next;
+	for (i = 0; i < nb_free_lists(h); i++) {
+		chunkid_t first = *free_list_head(h, i);
 		chunksz_t largest = 0;
 		int count = 0;
 
@@ -38,7 +38,7 @@ static void heap_print_info(struct z_heap *h, bool dump_chunks)
 		}
 		if (count) {
 			printk("%9d %12d %12d %12d %12zd\n",
-			       i, (1 << i) - 1 + min_chunk_size(h), count,
+			       i, free_list_min_size(h, i), count,
 			       largest, chunksz_to_bytes(h, largest));
 		}
 	}
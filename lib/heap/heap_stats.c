@@ -19,6 +19,16 @@ int sys_heap_runtime_stats_get(struct sys_heap *heap,
 	stats->allocated_bytes = heap->heap->allocated_bytes;
 	stats->max_allocated_bytes = heap->heap->max_allocated_bytes;
 
+#ifdef CONFIG_SYS_HEAP_CACHE
+	/* Cached blocks are free for the user, but still taken from the
+	 * heap itself, which is what the maximum usage reflects.
+	 */
+	size_t cached = MIN(cached_bytes(heap->heap), stats->allocated_bytes);
+
+	stats->free_bytes += cached;
+	stats->allocated_bytes -= cached;
+#endif
+
 	return 0;
 }
 
@@ -96,13 +96,24 @@ static size_t rand_free_choice(struct z_heap_stress_rec *sr)
 	return rand32() % sr->blocks_alloced;
 }
 
+static uint64_t cycles_now(void)
+{
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+	return k_cycle_get_64();
+#else
+	return k_cycle_get_32();
+#endif
+}
+
 /* General purpose heap stress test.  Takes function pointers to allow
  * for testing multiple heap APIs with the same rig.  The alloc and
  * free functions are passed back the argument as a context pointer.
  * The "log" function is for readable user output.  The total_bytes
  * argument should reflect the size of the heap being tested.  The
  * scratch array is used to store temporary state and should be sized
- * about half as large as the heap itself. Returns true on success.
+ * about half as large as the heap itself.  The time taken by the
+ * operations, including the callbacks, is reported as a number of
+ * operations per second.
  */
 void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
 		     void (*free_fn)(void *arg, void *p),
@@ -122,8 +133,12 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
 	       .target_percent = target_percent,
 	};
 
+	uint64_t cycles;
+
 	*result = (struct z_heap_stress_result) {0};
 
+	cycles = cycles_now();
+
 	for (uint32_t i = 0; i < op_count; i++) {
 		if (rand_alloc_choice(&sr)) {
 			size_t sz = rand_alloc_size(&sr);
@@ -150,4 +165,14 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
 		}
 		result->accumulated_in_use_bytes += sr.bytes_alloced;
 	}
+
+	cycles = cycles_now() - cycles;
+#ifndef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+	cycles = (uint32_t)cycles;
+#endif
+	if (cycles != 0U) {
+		result->ops_per_sec = (uint32_t)MIN(((uint64_t)op_count *
+						     sys_clock_hw_cycles_per_sec()) / cycles,
+						    UINT32_MAX);
+	}
 }
@@ -54,17 +54,17 @@ static bool valid_chunk(struct z_heap *h, chunkid_t c)
  */
 static inline void check_nexts(struct z_heap *h, int bidx)
 {
-	struct z_heap_bucket *b = &h->buckets[bidx];
+	chunkid_t next = *free_list_head(h, bidx);
 
-	bool emptybit = (h->avail_buckets & BIT(bidx)) == 0;
-	bool emptylist = b->next == 0;
+	bool emptybit = !free_list_avail(h, bidx);
+	bool emptylist = next == 0;
 	bool empties_match = emptybit == emptylist;
 
 	(void)empties_match;
 	CHECK(empties_match);
 
-	if (b->next != 0) {
-		CHECK(valid_chunk(h, b->next));
+	if (next != 0) {
+		CHECK(valid_chunk(h, next));
 	}
 }
 
@@ -107,8 +107,8 @@ bool sys_heap_validate(struct sys_heap *heap)
 	 * should be correct, and all chunk entries should point into
 	 * valid unused chunks.  Mark those chunks USED, temporarily.
 	 */
-	for (int b = 0; b <= bucket_idx(h, h->end_chunk); b++) {
-		chunkid_t c0 = h->buckets[b].next;
+	for (int b = 0; b < nb_free_lists(h); b++) {
+		chunkid_t c0 = *free_list_head(h, b);
 		uint32_t n = 0;
 
 		check_nexts(h, b);
@@ -118,21 +118,34 @@ bool sys_heap_validate(struct sys_heap *heap)
 			if (!valid_chunk(h, c)) {
 				return false;
 			}
+			if (free_list_idx(h, chunk_size(h, c)) != b) {
+				return false;
+			}
 			set_chunk_used(h, c, true);
 		}
 
-		bool empty = (h->avail_buckets & BIT(b)) == 0;
+		bool empty = !free_list_avail(h, b);
 		bool zero = n == 0;
 
 		if (empty != zero) {
 			return false;
 		}
 
-		if (empty && (h->buckets[b].next != 0)) {
+		if (empty && (c0 != 0)) {
 			return false;
 		}
 	}
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+	for (int b = 0; b <= bucket_idx(h, h->end_chunk); b++) {
+		bool empty = (h->avail_buckets & BIT(b)) == 0;
+
+		if (empty != (h->buckets[b].avail_lists == 0U)) {
+			return false;
+		}
+	}
+#endif
+
 	/*
 	 * Walk through the chunks linearly again, verifying that all chunks
 	 * but solo headers are now USED (i.e. all free blocks were found
@@ -160,8 +173,8 @@ bool sys_heap_validate(struct sys_heap *heap)
 	 * pass caught all the blocks and that they now show UNUSED.
 	 * Mark them USED.
 	 */
-	for (int b = 0; b <= bucket_idx(h, h->end_chunk); b++) {
-		chunkid_t c0 = h->buckets[b].next;
+	for (int b = 0; b < nb_free_lists(h); b++) {
+		chunkid_t c0 = *free_list_head(h, b);
 		int n = 0;
 
 		if (c0 == 0) {
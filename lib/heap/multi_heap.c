@@ -6,11 +6,24 @@
 #include <zephyr/sys/sys_heap.h>
 #include <zephyr/sys/multi_heap.h>
 #include <string.h>
+#include <errno.h>
+
+#ifdef CONFIG_MULTI_HEAP_AFFINITY
+#include <zephyr/kernel.h>
+
+static void update_chains(struct sys_multi_heap *mheap);
+#endif
 
 void sys_multi_heap_init(struct sys_multi_heap *heap, sys_multi_heap_fn_t choice_fn)
 {
 	heap->nheaps = 0;
 	heap->choice = choice_fn;
+
+#ifdef CONFIG_MULTI_HEAP_AFFINITY
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		heap->preferred[cpu] = NULL;
+	}
+#endif
 }
 
 void sys_multi_heap_add_heap(struct sys_multi_heap *mheap,
@@ -19,6 +32,11 @@ void sys_multi_heap_add_heap(struct sys_multi_heap *mheap,
 	__ASSERT_NO_MSG(mheap->nheaps < ARRAY_SIZE(mheap->heaps));
 
 	mheap->heaps[mheap->nheaps].heap = heap;
+#ifdef CONFIG_MULTI_HEAP_AFFINITY
+	mheap->heaps[mheap->nheaps].cpu_mask = 0;
+	mheap->heaps[mheap->nheaps].stats =
+		(struct sys_multi_heap_region_stats){ 0 };
+#endif
 	mheap->heaps[mheap->nheaps++].user_data = user_data;
 
 	/* Now sort them in memory order, simple extraction sort */
@@ -39,6 +57,10 @@ void sys_multi_heap_add_heap(struct sys_multi_heap *mheap,
 		mheap->heaps[i] = mheap->heaps[lowest];
 		mheap->heaps[lowest] = swap;
 	}
+
+#ifdef CONFIG_MULTI_HEAP_AFFINITY
+	update_chains(mheap);
+#endif
 }
 
 void *sys_multi_heap_alloc(struct sys_multi_heap *mheap, void *cfg, size_t bytes)
@@ -126,3 +148,164 @@ void *sys_multi_heap_aligned_realloc(struct sys_multi_heap *mheap, void *cfg,
 
 	return new_ptr;
 }
+
+#ifdef CONFIG_MULTI_HEAP_AFFINITY
+
+/* Classes of heaps, in the order a CPU tries them */
+enum heap_class {
+	HEAP_PREFERRED,
+	HEAP_LOCAL,
+	HEAP_SHARED,
+	HEAP_REMOTE,
+	HEAP_CLASSES,
+};
+
+static enum heap_class heap_class(const struct sys_multi_heap *mheap,
+				  const struct sys_multi_heap_rec *rec, int cpu)
+{
+	if (rec->heap == mheap->preferred[cpu]) {
+		return HEAP_PREFERRED;
+	}
+	if (rec->cpu_mask == 0) {
+		return HEAP_SHARED;
+	}
+
+	return (rec->cpu_mask & BIT(cpu)) != 0 ? HEAP_LOCAL : HEAP_REMOTE;
+}
+
+/* The chains are computed when the heaps are set up rather than at
+ * allocation time, as heaps[] is kept in memory order.
+ */
+static void update_chains(struct sys_multi_heap *mheap)
+{
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		int n = 0;
+
+		for (int class = 0; class < HEAP_CLASSES; class++) {
+			for (int i = 0; i < mheap->nheaps; i++) {
+				if (heap_class(mheap, &mheap->heaps[i], cpu) == class) {
+					mheap->chain[cpu][n++] = i;
+				}
+			}
+		}
+	}
+}
+
+static struct sys_multi_heap_rec *find_rec(const struct sys_multi_heap *mheap,
+					   const struct sys_heap *heap)
+{
+	for (int i = 0; i < mheap->nheaps; i++) {
+		if (mheap->heaps[i].heap == heap) {
+			return (struct sys_multi_heap_rec *)&mheap->heaps[i];
+		}
+	}
+
+	return NULL;
+}
+
+int sys_multi_heap_set_affinity(struct sys_multi_heap *mheap,
+				struct sys_heap *heap, uint32_t cpu_mask)
+{
+	struct sys_multi_heap_rec *rec = find_rec(mheap, heap);
+
+	if (rec == NULL) {
+		return -ENOENT;
+	}
+
+	rec->cpu_mask = cpu_mask;
+	update_chains(mheap);
+
+	return 0;
+}
+
+int sys_multi_heap_set_preferred(struct sys_multi_heap *mheap,
+				 unsigned int cpu, struct sys_heap *heap)
+{
+	if (cpu >= CONFIG_MP_MAX_NUM_CPUS) {
+		return -EINVAL;
+	}
+	if ((heap != NULL) && (find_rec(mheap, heap) == NULL)) {
+		return -ENOENT;
+	}
+
+	mheap->preferred[cpu] = heap;
+	update_chains(mheap);
+
+	return 0;
+}
+
+static inline int current_cpu(void)
+{
+	unsigned int key;
+	int cpu;
+
+	if (CONFIG_MP_MAX_NUM_CPUS == 1) {
+		return 0;
+	}
+
+	/* Migrating right after only makes a worse choice */
+	key = arch_irq_lock();
+	cpu = _current_cpu->id;
+	arch_irq_unlock(key);
+
+	return cpu;
+}
+
+void *sys_multi_heap_affinity_alloc(struct sys_multi_heap *mheap,
+				    sys_multi_heap_filter_fn_t filter,
+				    void *cfg, size_t align, size_t bytes)
+{
+	const uint8_t *chain = mheap->chain[current_cpu()];
+	bool first = true;
+
+	if (bytes == 0) {
+		return NULL;
+	}
+
+	for (int i = 0; i < mheap->nheaps; i++) {
+		struct sys_multi_heap_rec *rec = &mheap->heaps[chain[i]];
+		void *block;
+
+		if ((filter != NULL) && !filter(rec, cfg)) {
+			continue;
+		}
+
+		block = sys_heap_aligned_alloc(rec->heap, align, bytes);
+		if (block != NULL) {
+			rec->stats.allocs++;
+			if (!first) {
+				rec->stats.fallbacks++;
+			}
+			return block;
+		}
+
+		first = false;
+	}
+
+	return NULL;
+}
+
+void *sys_multi_heap_affinity_choice(struct sys_multi_heap *mheap, void *cfg,
+				     size_t align, size_t size)
+{
+	ARG_UNUSED(cfg);
+
+	return sys_multi_heap_affinity_alloc(mheap, NULL, NULL, align, size);
+}
+
+int sys_multi_heap_region_stats_get(const struct sys_multi_heap *mheap,
+				    const struct sys_heap *heap,
+				    struct sys_multi_heap_region_stats *stats)
+{
+	const struct sys_multi_heap_rec *rec = find_rec(mheap, heap);
+
+	if (rec == NULL) {
+		return -ENOENT;
+	}
+
+	*stats = rec->stats;
+
+	return 0;
+}
+
+#endif /* CONFIG_MULTI_HEAP_AFFINITY */
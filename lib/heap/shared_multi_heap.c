@@ -18,6 +18,28 @@ static struct {
 	unsigned int heap_cnt;
 } smh_data[MAX_SHARED_MULTI_HEAP_ATTR];
 
+#ifdef CONFIG_MULTI_HEAP_AFFINITY
+static bool smh_filter(const struct sys_multi_heap_rec *rec, void *cfg)
+{
+	enum shared_multi_heap_attr attr = (enum shared_multi_heap_attr)(long) cfg;
+
+	return (rec->heap >= &smh_data[attr].heap_pool[0]) &&
+	       (rec->heap < &smh_data[attr].heap_pool[smh_data[attr].heap_cnt]);
+}
+
+static void *smh_choice(struct sys_multi_heap *mheap, void *cfg, size_t align, size_t size)
+{
+	enum shared_multi_heap_attr attr;
+
+	attr = (enum shared_multi_heap_attr)(long) cfg;
+
+	if (attr >= MAX_SHARED_MULTI_HEAP_ATTR || size == 0) {
+		return NULL;
+	}
+
+	return sys_multi_heap_affinity_alloc(mheap, smh_filter, cfg, align, size);
+}
+#else
 static void *smh_choice(struct sys_multi_heap *mheap, void *cfg, size_t align, size_t size)
 {
 	struct sys_heap *h;
@@ -48,6 +70,7 @@ static void *smh_choice(struct sys_multi_heap *mheap, void *cfg, size_t align, s
 
 	return block;
 }
+#endif /* CONFIG_MULTI_HEAP_AFFINITY */
 
 int shared_multi_heap_add(struct shared_multi_heap_region *region, void *user_data)
 {
@@ -71,6 +94,9 @@ int shared_multi_heap_add(struct shared_multi_heap_region *region, void *user_da
 
 	sys_heap_init(h, (void *) region->addr, region->size);
 	sys_multi_heap_add_heap(&shared_multi_heap, h, user_data);
+#ifdef CONFIG_MULTI_HEAP_AFFINITY
+	(void)sys_multi_heap_set_affinity(&shared_multi_heap, h, region->cpu_mask);
+#endif
 
 	smh_data[attr].heap_cnt++;
 
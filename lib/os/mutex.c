@@ -8,6 +8,7 @@
 #include <zephyr/sys/mutex.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/kernel_structs.h>
+#include <kernel_internal.h>
 
 static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 {
@@ -21,24 +22,82 @@ static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 	return obj->data.mutex;
 }
 
+/* The owner is read from user memory, it must be checked before the kernel
+ * mutex boosts its priority.  A user thread must have been granted access
+ * to it, as to any thread object it passes to a system call.
+ */
+static int check_owner(atomic_val_t val, bool user)
+{
+	struct k_object *obj;
+	int ret;
+
+	obj = k_object_find((void *)(val & ~SYS_MUTEX_WAITERS));
+
+	if (user) {
+		ret = k_object_validate(obj, K_OBJ_THREAD, _OBJ_INIT_TRUE);
+
+		return ((ret == 0) || (ret == -EPERM)) ? ret : -EINVAL;
+	}
+
+	if ((obj == NULL) || (obj->type != K_OBJ_THREAD) ||
+	    ((obj->flags & K_OBJ_FLAG_INITIALIZED) == 0U)) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
 static bool check_sys_mutex_addr(struct sys_mutex *addr)
 {
-	/* sys_mutex memory is never touched, just used to lookup the
-	 * underlying k_mutex, but we don't want threads using mutexes
-	 * that are outside their memory domain
+	/* sys_mutex memory holds the owner of the mutex, we don't want
+	 * threads using mutexes that are outside their memory domain
 	 */
 	return K_SYSCALL_MEMORY_WRITE(addr, sizeof(struct sys_mutex));
 }
 
-int z_impl_z_sys_mutex_kernel_lock(struct sys_mutex *mutex, k_timeout_t timeout)
+static int sys_mutex_kernel_lock(struct sys_mutex *mutex, k_timeout_t timeout,
+				 bool user)
 {
 	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
+	atomic_val_t val;
+	int ret;
 
 	if (kernel_mutex == NULL) {
 		return -EINVAL;
 	}
 
-	return k_mutex_lock(kernel_mutex, timeout);
+	do {
+		val = atomic_get(&mutex->val);
+
+		if ((val & ~SYS_MUTEX_WAITERS) == (atomic_val_t)_current) {
+			mutex->lock_count++;
+			return 0;
+		}
+
+		if (val != 0) {
+			if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+				return -EBUSY;
+			}
+
+			ret = check_owner(val, user);
+			if (ret != 0) {
+				return ret;
+			}
+		}
+
+		ret = z_mutex_user_lock(kernel_mutex, &mutex->val, val, timeout);
+	} while (ret > 0);
+
+	if (ret == 0) {
+		mutex->lock_count = 1U;
+	}
+
+	return ret;
+}
+
+int z_impl_z_sys_mutex_kernel_lock(struct sys_mutex *mutex, k_timeout_t timeout)
+{
+	return sys_mutex_kernel_lock(mutex, timeout, false);
 }
 
 static inline int z_vrfy_z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
@@ -48,7 +107,7 @@ static inline int z_vrfy_z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
 		return -EACCES;
 	}
 
-	return z_impl_z_sys_mutex_kernel_lock(mutex, timeout);
+	return sys_mutex_kernel_lock(mutex, timeout, true);
 }
 #include <zephyr/syscalls/z_sys_mutex_kernel_lock_mrsh.c>
 
@@ -56,11 +115,20 @@ int z_impl_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
 {
 	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
 
-	if ((kernel_mutex == NULL) || (kernel_mutex->lock_count == 0)) {
+	if (kernel_mutex == NULL) {
 		return -EINVAL;
 	}
 
-	return k_mutex_unlock(kernel_mutex);
+	if ((atomic_get(&mutex->val) & ~SYS_MUTEX_WAITERS) == (atomic_val_t)_current) {
+		if (mutex->lock_count > 1U) {
+			mutex->lock_count--;
+			return 0;
+		}
+
+		mutex->lock_count = 0U;
+	}
+
+	return z_mutex_user_unlock(kernel_mutex, &mutex->val);
 }
 
 static inline int z_vrfy_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
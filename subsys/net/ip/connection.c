@@ -18,6 +18,7 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #include <errno.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/kernel/rcu.h>
 
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
@@ -113,6 +114,100 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#if defined(CONFIG_NET_CONN_HASH)
+/* Handlers of a protocol and family bound to a local port, and the other
+ * UDP and TCP handlers, as far as net_conn_input() is concerned.
+ */
+static sys_slist_t conn_buckets[CONFIG_NET_CONN_HASH_BUCKETS];
+static sys_slist_t conn_wildcard;
+static uint32_t conn_seq;
+
+/* The port is in network byte order */
+static sys_slist_t *conn_bucket(uint16_t proto, uint8_t family, uint16_t port)
+{
+	uint32_t key = ((uint32_t)proto << 24) ^ ((uint32_t)family << 16) ^ port;
+
+	return &conn_buckets[((key * 2654435761U) >> 16) %
+			     CONFIG_NET_CONN_HASH_BUCKETS];
+}
+
+static sys_slist_t *conn_index_of(uint16_t proto, uint8_t family,
+				  uint8_t flags, uint16_t port)
+{
+	if (family != AF_INET && family != AF_INET6 && family != AF_UNSPEC) {
+		/* Never looked up by net_conn_input() */
+		return NULL;
+	}
+
+	if (family == AF_UNSPEC || !(flags & NET_CONN_LOCAL_PORT_SPEC)) {
+		return &conn_wildcard;
+	}
+
+	return conn_bucket(proto, family, port);
+}
+
+/* Must be called with conn_lock held */
+static void conn_index_add(struct net_conn *conn)
+{
+	conn->index = conn_index_of(conn->proto, conn->family, conn->flags,
+				    net_sin(&conn->local_addr)->sin_port);
+	if (conn->index != NULL) {
+		k_rcu_slist_prepend(conn->index, &conn->index_node);
+	}
+}
+
+/* Must be called with conn_lock held */
+static void conn_index_del(struct net_conn *conn)
+{
+	if (conn->index != NULL) {
+		k_rcu_slist_find_and_remove(conn->index, &conn->index_node);
+		conn->index = NULL;
+	}
+}
+
+/* Would binding conn to local_port move it to another list of the index? */
+static bool conn_index_moves(struct net_conn *conn, uint16_t local_port)
+{
+	uint8_t flags = local_port > 0U ? NET_CONN_LOCAL_PORT_SPEC : 0U;
+
+	return conn_index_of(conn->proto, conn->family, flags,
+			     htons(local_port)) != conn->index;
+}
+
+/* Is conn to be preferred over best_match, which has the same rank? */
+static bool conn_is_newer(struct net_conn *conn, struct net_conn *best_match)
+{
+	return (int32_t)(conn->seq - best_match->seq) > 0;
+}
+#else
+static inline void conn_index_add(struct net_conn *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static inline void conn_index_del(struct net_conn *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static inline bool conn_index_moves(struct net_conn *conn, uint16_t local_port)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(local_port);
+
+	return false;
+}
+
+/* Connections are walked from the newest one, which wins ties */
+static inline bool conn_is_newer(struct net_conn *conn, struct net_conn *best_match)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(best_match);
+
+	return false;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -137,7 +232,11 @@ static void conn_set_used(struct net_conn *conn)
 	conn->flags |= NET_CONN_IN_USE;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
-	sys_slist_prepend(&conn_used, &conn->node);
+#if defined(CONFIG_NET_CONN_HASH)
+	conn->seq = conn_seq++;
+#endif
+	k_rcu_slist_prepend(&conn_used, &conn->node);
+	conn_index_add(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -150,119 +249,256 @@ static void conn_set_unused(struct net_conn *conn)
 	k_mutex_unlock(&conn_lock);
 }
 
-/* Check if we already have identical connection handler installed. */
-static struct net_conn *conn_find_handler(struct net_if *iface,
-					  uint16_t proto, uint8_t family,
-					  const struct sockaddr *remote_addr,
-					  const struct sockaddr *local_addr,
-					  uint16_t remote_port,
-					  uint16_t local_port,
-					  bool reuseport_set)
+#if defined(CONFIG_NET_CONN_RCU)
+/* Connections are only ever recycled or moved to another list after an RCU
+ * grace period, so the lookups do not need to exclude the updaters.
+ */
+static inline void conn_lookup_lock(void)
 {
-	struct net_conn *conn;
-	struct net_conn *tmp;
+	k_rcu_read_lock();
+}
+
+static inline void conn_lookup_unlock(void)
+{
+	k_rcu_read_unlock();
+}
+
+static void conn_rcu_done(struct k_rcu_head *head)
+{
+	struct net_conn *conn = CONTAINER_OF(head, struct net_conn, rcu);
+	bool in_use;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&conn_used, conn, tmp, node) {
-		if (conn->proto != proto) {
-			continue;
-		}
+	conn->rcu_pending = 0U;
+
+	/* Still registered, so it was taken out of the index to be updated */
+	in_use = (conn->flags & NET_CONN_IN_USE) != 0U;
+	if (in_use) {
+		conn_index_add(conn);
+	}
+
+	k_mutex_unlock(&conn_lock);
+
+	if (!in_use) {
+		conn_set_unused(conn);
+	}
+}
+
+/* Must be called with conn_lock held, once conn was taken out of the lists
+ * of the lookups. It is then either indexed again or recycled, depending on
+ * whether it is still in use, once no lookup can be looking at it any more.
+ */
+static void conn_rcu_defer(struct net_conn *conn)
+{
+	/* A pending callback follows a reindexing, which only happens with
+	 * CONFIG_NET_CONN_HASH, where the lookups do not walk conn_used.
+	 * conn has then been out of the index since before it was queued.
+	 */
+	if (conn->rcu_pending == 0U) {
+		conn->rcu_pending = 1U;
+		k_rcu_call(&conn->rcu, conn_rcu_done);
+	}
+}
 
-		if (conn->family != family) {
-			continue;
+static inline void conn_release(struct net_conn *conn)
+{
+	conn_rcu_defer(conn);
+}
+
+static inline void conn_reindex(struct net_conn *conn)
+{
+	conn_rcu_defer(conn);
+}
+#else
+static inline void conn_lookup_lock(void)
+{
+	k_mutex_lock(&conn_lock, K_FOREVER);
+}
+
+static inline void conn_lookup_unlock(void)
+{
+	k_mutex_unlock(&conn_lock);
+}
+
+/* Must be called with conn_lock held, which excludes the lookups */
+static inline void conn_release(struct net_conn *conn)
+{
+	conn_set_unused(conn);
+}
+
+/* Must be called with conn_lock held */
+static inline void conn_reindex(struct net_conn *conn)
+{
+	conn_index_add(conn);
+}
+#endif /* CONFIG_NET_CONN_RCU */
+
+/* Is conn identical to the connection handler about to be installed? */
+static bool conn_is_identical(struct net_conn *conn, struct net_if *iface,
+			      uint16_t proto, uint8_t family,
+			      const struct sockaddr *remote_addr,
+			      const struct sockaddr *local_addr,
+			      uint16_t remote_port,
+			      uint16_t local_port,
+			      bool reuseport_set)
+{
+	if (conn->proto != proto) {
+		return false;
+	}
+
+	if (conn->family != family) {
+		return false;
+	}
+
+	if (local_addr) {
+		if (!(conn->flags & NET_CONN_LOCAL_ADDR_SET)) {
+			return false;
 		}
 
-		if (local_addr) {
-			if (!(conn->flags & NET_CONN_LOCAL_ADDR_SET)) {
-				continue;
+		if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		    local_addr->sa_family == AF_INET6 &&
+		    local_addr->sa_family ==
+		    conn->local_addr.sa_family) {
+			if (!net_ipv6_addr_cmp(
+				    &net_sin6(local_addr)->sin6_addr,
+				    &net_sin6(&conn->local_addr)->
+							sin6_addr)) {
+				return false;
 			}
-
-			if (IS_ENABLED(CONFIG_NET_IPV6) &&
-			    local_addr->sa_family == AF_INET6 &&
-			    local_addr->sa_family ==
-			    conn->local_addr.sa_family) {
-				if (!net_ipv6_addr_cmp(
-					    &net_sin6(local_addr)->sin6_addr,
-					    &net_sin6(&conn->local_addr)->
-								sin6_addr)) {
-					continue;
-				}
-			} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
-				   local_addr->sa_family == AF_INET &&
-				   local_addr->sa_family ==
-				   conn->local_addr.sa_family) {
-				if (!net_ipv4_addr_cmp(
-					    &net_sin(local_addr)->sin_addr,
-					    &net_sin(&conn->local_addr)->
-								sin_addr)) {
-					continue;
-				}
-			} else {
-				continue;
+		} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+			   local_addr->sa_family == AF_INET &&
+			   local_addr->sa_family ==
+			   conn->local_addr.sa_family) {
+			if (!net_ipv4_addr_cmp(
+				    &net_sin(local_addr)->sin_addr,
+				    &net_sin(&conn->local_addr)->
+							sin_addr)) {
+				return false;
 			}
-		} else if (conn->flags & NET_CONN_LOCAL_ADDR_SET) {
-			continue;
+		} else {
+			return false;
 		}
+	} else if (conn->flags & NET_CONN_LOCAL_ADDR_SET) {
+		return false;
+	}
 
-		if (net_sin(&conn->local_addr)->sin_port !=
-		    htons(local_port)) {
-			continue;
+	if (net_sin(&conn->local_addr)->sin_port !=
+	    htons(local_port)) {
+		return false;
+	}
+
+	if (remote_addr) {
+		if (!(conn->flags & NET_CONN_REMOTE_ADDR_SET)) {
+			return false;
 		}
 
-		if (remote_addr) {
-			if (!(conn->flags & NET_CONN_REMOTE_ADDR_SET)) {
-				continue;
+		if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		    remote_addr->sa_family == AF_INET6 &&
+		    remote_addr->sa_family ==
+		    conn->remote_addr.sa_family) {
+			if (!net_ipv6_addr_cmp(
+				    &net_sin6(remote_addr)->sin6_addr,
+				    &net_sin6(&conn->remote_addr)->
+							sin6_addr)) {
+				return false;
 			}
-
-			if (IS_ENABLED(CONFIG_NET_IPV6) &&
-			    remote_addr->sa_family == AF_INET6 &&
-			    remote_addr->sa_family ==
-			    conn->remote_addr.sa_family) {
-				if (!net_ipv6_addr_cmp(
-					    &net_sin6(remote_addr)->sin6_addr,
-					    &net_sin6(&conn->remote_addr)->
-								sin6_addr)) {
-					continue;
-				}
-			} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
-				   remote_addr->sa_family == AF_INET &&
-				   remote_addr->sa_family ==
-				   conn->remote_addr.sa_family) {
-				if (!net_ipv4_addr_cmp(
-					    &net_sin(remote_addr)->sin_addr,
-					    &net_sin(&conn->remote_addr)->
-								sin_addr)) {
-					continue;
-				}
-			} else {
-				continue;
+		} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+			   remote_addr->sa_family == AF_INET &&
+			   remote_addr->sa_family ==
+			   conn->remote_addr.sa_family) {
+			if (!net_ipv4_addr_cmp(
+				    &net_sin(remote_addr)->sin_addr,
+				    &net_sin(&conn->remote_addr)->
+							sin_addr)) {
+				return false;
 			}
-		} else if (conn->flags & NET_CONN_REMOTE_ADDR_SET) {
-			continue;
-		} else if (reuseport_set && conn->context != NULL &&
-			   net_context_is_reuseport_set(conn->context)) {
-			continue;
+		} else {
+			return false;
 		}
+	} else if (conn->flags & NET_CONN_REMOTE_ADDR_SET) {
+		return false;
+	} else if (reuseport_set && conn->context != NULL &&
+		   net_context_is_reuseport_set(conn->context)) {
+		return false;
+	}
+
+	if (net_sin(&conn->remote_addr)->sin_port !=
+	    htons(remote_port)) {
+		return false;
+	}
 
-		if (net_sin(&conn->remote_addr)->sin_port !=
-		    htons(remote_port)) {
-			continue;
+	if (conn->context != NULL && iface != NULL &&
+	    net_context_is_bound_to_iface(conn->context)) {
+		if (iface != net_context_get_iface(conn->context)) {
+			return false;
 		}
+	}
 
-		if (conn->context != NULL && iface != NULL &&
-		    net_context_is_bound_to_iface(conn->context)) {
-			if (iface != net_context_get_iface(conn->context)) {
-				continue;
+	return true;
+}
+
+/* Check if we already have identical connection handler installed. */
+static struct net_conn *conn_find_handler(struct net_if *iface,
+					  uint16_t proto, uint8_t family,
+					  const struct sockaddr *remote_addr,
+					  const struct sockaddr *local_addr,
+					  uint16_t remote_port,
+					  uint16_t local_port,
+					  bool reuseport_set)
+{
+	struct net_conn *conn;
+	struct net_conn *tmp;
+
+	k_mutex_lock(&conn_lock, K_FOREVER);
+
+#if defined(CONFIG_NET_CONN_HASH)
+	/* An identical handler of a UDP or TCP family is bound to the same
+	 * local port, or to none.
+	 */
+	if (family == AF_INET || family == AF_INET6 || family == AF_UNSPEC) {
+		if (family != AF_UNSPEC && local_port > 0U) {
+			sys_slist_t *bucket = conn_bucket(proto, family, htons(local_port));
+
+			SYS_SLIST_FOR_EACH_CONTAINER(bucket, conn, index_node) {
+				if (conn_is_identical(conn, iface, proto, family,
+						      remote_addr, local_addr,
+						      remote_port, local_port,
+						      reuseport_set)) {
+					goto found;
+				}
+			}
+		}
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&conn_wildcard, conn, index_node) {
+			if (conn_is_identical(conn, iface, proto, family,
+					      remote_addr, local_addr,
+					      remote_port, local_port,
+					      reuseport_set)) {
+				goto found;
 			}
 		}
 
 		k_mutex_unlock(&conn_lock);
-		return conn;
+		return NULL;
+	}
+#endif /* CONFIG_NET_CONN_HASH */
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&conn_used, conn, tmp, node) {
+		if (conn_is_identical(conn, iface, proto, family,
+				      remote_addr, local_addr,
+				      remote_port, local_port,
+				      reuseport_set)) {
+			goto found;
+		}
 	}
 
 	k_mutex_unlock(&conn_lock);
 	return NULL;
+
+found:
+	k_mutex_unlock(&conn_lock);
+	return conn;
 }
 
 static void net_conn_change_callback(struct net_conn *conn,
@@ -435,10 +671,10 @@ int net_conn_register(uint16_t proto, enum net_sock_type type, uint8_t family,
 		*handle = (struct net_conn_handle *)conn;
 	}
 
-	conn_set_used(conn);
-
 	conn->v6only = net_context_is_v6only_set(context);
 
+	conn_set_used(conn);
+
 	conn_register_debug(conn, remote_port, local_port);
 
 	return 0;
@@ -462,11 +698,12 @@ int net_conn_unregister(struct net_conn_handle *handle)
 	NET_DBG("Connection handler %p removed", conn);
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
-	sys_slist_find_and_remove(&conn_used, &conn->node);
+	k_rcu_slist_find_and_remove(&conn_used, &conn->node);
+	conn_index_del(conn);
+	conn->flags &= ~NET_CONN_IN_USE;
+	conn_release(conn);
 	k_mutex_unlock(&conn_lock);
 
-	conn_set_unused(conn);
-
 	return 0;
 }
 
@@ -479,6 +716,7 @@ int net_conn_update(struct net_conn_handle *handle,
 		    uint16_t local_port)
 {
 	struct net_conn *conn = (struct net_conn *)handle;
+	bool reindex;
 	int ret;
 
 	if (conn < &conns[0] || conn > &conns[CONFIG_NET_MAX_CONN]) {
@@ -489,14 +727,29 @@ int net_conn_update(struct net_conn_handle *handle,
 		return -ENOENT;
 	}
 
+	k_mutex_lock(&conn_lock, K_FOREVER);
+
+	/* With CONFIG_NET_CONN_RCU, lookups may see the endpoints change
+	 * under them, and miss conn until it is indexed again after a grace
+	 * period. Packets arriving meanwhile are dropped.
+	 */
+	reindex = conn_index_moves(conn, local_port);
+	if (reindex) {
+		conn_index_del(conn);
+	}
+
 	net_conn_change_callback(conn, cb, user_data);
 
 	ret = net_conn_change_local(conn, local_addr, local_port);
-	if (ret < 0) {
-		return ret;
+	if (ret == 0) {
+		ret = net_conn_change_remote(conn, remote_addr, remote_port);
 	}
 
-	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+	if (reindex) {
+		conn_reindex(conn);
+	}
+
+	k_mutex_unlock(&conn_lock);
 
 	return ret;
 }
@@ -872,6 +1125,207 @@ enum net_verdict net_conn_can_input(struct net_pkt *pkt, uint8_t proto)
 }
 #endif /* defined(CONFIG_NET_SOCKETS_CAN) */
 
+/* State of the lookup of the connection of an incoming packet */
+struct conn_lookup {
+	struct net_pkt *pkt;
+	union net_ip_header *ip_hdr;
+	union net_proto_header *proto_hdr;
+	uint16_t src_port;
+	uint16_t dst_port;
+	uint8_t proto;
+	bool is_mcast_pkt;
+	bool mcast_pkt_delivered;
+	int16_t best_rank;
+	struct net_conn *best_match;
+};
+
+/* Rank the candidate connection for the packet, or deliver the packet to
+ * it right away if it is a multicast one.
+ */
+static int conn_lookup_check(struct conn_lookup *lookup, struct net_conn *conn)
+{
+	struct net_pkt *pkt = lookup->pkt;
+	uint8_t pkt_family = net_pkt_family(pkt);
+
+	/* Is the candidate connection matching the packet's interface? */
+	if (!is_iface_matching(conn, pkt)) {
+		return 0; /* wrong interface */
+	}
+
+	/* Is the candidate connection matching the packet's protocol family? */
+	if (conn->family != AF_UNSPEC && conn->family != pkt_family) {
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+			      !conn->v6only && conn->type != SOCK_RAW)) {
+				return 0;
+			}
+		} else {
+			return 0; /* wrong protocol family */
+		}
+
+		/* We might have a match for v4-to-v6 mapping, check more */
+	}
+
+	/* Is the candidate connection matching the packet's protocol within the family? */
+	if (conn->proto != lookup->proto) {
+		return 0; /* wrong protocol */
+	}
+
+	/* Apply protocol-specific matching criteria... */
+	uint8_t conn_family = conn->family;
+
+	if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
+	    (conn_family == AF_INET || conn_family == AF_INET6 ||
+	     conn_family == AF_UNSPEC)) {
+		/* Is the candidate connection matching the packet's TCP/UDP
+		 * address and port?
+		 */
+		if ((conn->flags & NET_CONN_REMOTE_PORT_SPEC) != 0 &&
+		    net_sin(&conn->remote_addr)->sin_port != lookup->src_port) {
+			return 0; /* wrong remote port */
+		}
+
+		if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0 &&
+		    net_sin(&conn->local_addr)->sin_port != lookup->dst_port) {
+			return 0; /* wrong local port */
+		}
+
+		if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) != 0 &&
+		    !conn_addr_cmp(pkt, lookup->ip_hdr, &conn->remote_addr, true)) {
+			return 0; /* wrong remote address */
+		}
+
+		if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) != 0 &&
+		    !conn_addr_cmp(pkt, lookup->ip_hdr, &conn->local_addr, false)) {
+
+			/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
+			 * has no IPV6_V6ONLY option set and if the local IPV6 address
+			 * is unspecified, then we could accept a connection from IPv4
+			 * address by mapping it to IPv6 address.
+			 */
+			if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+				if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+				      !conn->v6only &&
+				      net_ipv6_is_addr_unspecified(
+					      &net_sin6(&conn->local_addr)->sin6_addr))) {
+					return 0; /* wrong local address */
+				}
+			} else {
+				return 0; /* wrong local address */
+			}
+
+			/* We might have a match for v4-to-v6 mapping,
+			 * continue with rank checking.
+			 */
+		}
+
+		if (lookup->best_rank < NET_CONN_RANK(conn->flags) ||
+		    (lookup->best_rank == NET_CONN_RANK(conn->flags) &&
+		     conn_is_newer(conn, lookup->best_match))) {
+			struct net_pkt *mcast_pkt;
+
+			if (!lookup->is_mcast_pkt) {
+				lookup->best_rank = NET_CONN_RANK(conn->flags);
+				lookup->best_match = conn;
+
+				return 0; /* found a match - but maybe not yet the best */
+			}
+
+			/* If we have a multicast packet, and we found
+			 * a match, then deliver the packet immediately
+			 * to the handler. As there might be several
+			 * sockets interested about these, we need to
+			 * clone the received pkt.
+			 */
+
+			NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
+				conn->user_data);
+
+			mcast_pkt = net_pkt_clone(
+				pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
+			if (!mcast_pkt) {
+				return -ENOMEM;
+			}
+
+			if (conn->cb(conn, mcast_pkt, lookup->ip_hdr, lookup->proto_hdr,
+				     conn->user_data) == NET_DROP) {
+				net_stats_update_per_proto_drop(net_pkt_iface(pkt), lookup->proto);
+				net_pkt_unref(mcast_pkt);
+			} else {
+				net_stats_update_per_proto_recv(net_pkt_iface(pkt), lookup->proto);
+			}
+
+			lookup->mcast_pkt_delivered = true;
+		}
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_NET_CONN_HASH)
+static int conn_lookup_list(struct conn_lookup *lookup, sys_slist_t *list)
+{
+	struct net_conn *conn;
+	int ret;
+
+	K_RCU_SLIST_FOR_EACH_CONTAINER(list, conn, index_node) {
+		ret = conn_lookup_check(lookup, conn);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+/* Only the connections bound to the destination port of the packet, and
+ * the ones bound to no port, can match it.
+ */
+static int conn_lookup(struct conn_lookup *lookup)
+{
+	uint8_t pkt_family = net_pkt_family(lookup->pkt);
+	sys_slist_t *bucket;
+	sys_slist_t *mapped;
+	int ret;
+
+	bucket = conn_bucket(lookup->proto, pkt_family, lookup->dst_port);
+
+	ret = conn_lookup_list(lookup, bucket);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6) && pkt_family == AF_INET) {
+		mapped = conn_bucket(lookup->proto, AF_INET6, lookup->dst_port);
+
+		/* Both families may well share the bucket */
+		if (mapped != bucket) {
+			ret = conn_lookup_list(lookup, mapped);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+	}
+
+	return conn_lookup_list(lookup, &conn_wildcard);
+}
+#else
+static int conn_lookup(struct conn_lookup *lookup)
+{
+	struct net_conn *conn;
+	int ret;
+
+	K_RCU_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
+		ret = conn_lookup_check(lookup, conn);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 enum net_verdict net_conn_input(struct net_pkt *pkt,
 				union net_ip_header *ip_hdr,
 				uint8_t proto,
@@ -912,152 +1366,52 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		" family %d", net_proto2str(net_pkt_family(pkt), proto), pkt,
 		ntohs(src_port), ntohs(dst_port), net_pkt_family(pkt));
 
-	struct net_conn *best_match = NULL;
-	int16_t best_rank = -1;
-	bool is_mcast_pkt = false;
-	bool mcast_pkt_delivered = false;
+	struct conn_lookup lookup = {
+		.pkt = pkt,
+		.ip_hdr = ip_hdr,
+		.proto_hdr = proto_hdr,
+		.src_port = src_port,
+		.dst_port = dst_port,
+		.proto = proto,
+		.best_rank = -1,
+	};
 	bool is_bcast_pkt = false;
-	struct net_conn *conn;
+	struct net_conn *best_match;
 	net_conn_cb_t cb = NULL;
 	void *user_data = NULL;
+	int ret;
 
 	/* If we receive a packet with multicast destination address, we might
 	 * need to deliver the packet to multiple recipients.
 	 */
 	if (IS_ENABLED(CONFIG_NET_IPV4) && pkt_family == AF_INET) {
 		if (net_ipv4_is_addr_mcast_raw(ip_hdr->ipv4->dst)) {
-			is_mcast_pkt = true;
+			lookup.is_mcast_pkt = true;
 		} else if (net_if_ipv4_is_addr_bcast_raw(pkt_iface,
 							 ip_hdr->ipv4->dst)) {
 			is_bcast_pkt = true;
 		}
 	} else if (IS_ENABLED(CONFIG_NET_IPV6) && pkt_family == AF_INET6) {
-		is_mcast_pkt = net_ipv6_is_addr_mcast_raw(ip_hdr->ipv6->dst);
+		lookup.is_mcast_pkt = net_ipv6_is_addr_mcast_raw(ip_hdr->ipv6->dst);
 	}
 
-	k_mutex_lock(&conn_lock, K_FOREVER);
-
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
-		/* Is the candidate connection matching the packet's interface? */
-		if (!is_iface_matching(conn, pkt)) {
-			continue; /* wrong interface */
-		}
-
-		/* Is the candidate connection matching the packet's protocol family? */
-		if (conn->family != AF_UNSPEC && conn->family != pkt_family) {
-			if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-				if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-				      !conn->v6only && conn->type != SOCK_RAW)) {
-					continue;
-				}
-			} else {
-				continue; /* wrong protocol family */
-			}
-
-			/* We might have a match for v4-to-v6 mapping, check more */
-		}
-
-		/* Is the candidate connection matching the packet's protocol within the family? */
-		if (conn->proto != proto) {
-			continue; /* wrong protocol */
-		}
-
-		/* Apply protocol-specific matching criteria... */
-		uint8_t conn_family = conn->family;
-
-		if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
-		    (conn_family == AF_INET || conn_family == AF_INET6 ||
-		     conn_family == AF_UNSPEC)) {
-			/* Is the candidate connection matching the packet's TCP/UDP
-			 * address and port?
-			 */
-			if ((conn->flags & NET_CONN_REMOTE_PORT_SPEC) != 0 &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
-
-			if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0 &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
-			}
-
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) != 0 &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
-			}
+	conn_lookup_lock();
 
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) != 0 &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
-
-				/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
-				 * has no IPV6_V6ONLY option set and if the local IPV6 address
-				 * is unspecified, then we could accept a connection from IPv4
-				 * address by mapping it to IPv6 address.
-				 */
-				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-					if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-					      !conn->v6only &&
-					      net_ipv6_is_addr_unspecified(
-						      &net_sin6(&conn->local_addr)->sin6_addr))) {
-						continue; /* wrong local address */
-					}
-				} else {
-					continue; /* wrong local address */
-				}
-
-				/* We might have a match for v4-to-v6 mapping,
-				 * continue with rank checking.
-				 */
-			}
-
-			if (best_rank < NET_CONN_RANK(conn->flags)) {
-				struct net_pkt *mcast_pkt;
-
-				if (!is_mcast_pkt) {
-					best_rank = NET_CONN_RANK(conn->flags);
-					best_match = conn;
-
-					continue; /* found a match - but maybe not yet the best */
-				}
-
-				/* If we have a multicast packet, and we found
-				 * a match, then deliver the packet immediately
-				 * to the handler. As there might be several
-				 * sockets interested about these, we need to
-				 * clone the received pkt.
-				 */
-
-				NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
-					conn->user_data);
-
-				mcast_pkt = net_pkt_clone(
-					pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
-				if (!mcast_pkt) {
-					k_mutex_unlock(&conn_lock);
-					goto drop;
-				}
-
-				if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
-				    NET_DROP) {
-					net_stats_update_per_proto_drop(pkt_iface, proto);
-					net_pkt_unref(mcast_pkt);
-				} else {
-					net_stats_update_per_proto_recv(pkt_iface, proto);
-				}
-
-				mcast_pkt_delivered = true;
-			}
-		}
-	} /* loop end */
+	ret = conn_lookup(&lookup);
+	if (ret < 0) {
+		conn_lookup_unlock();
+		goto drop;
+	}
 
+	best_match = lookup.best_match;
 	if (best_match != NULL) {
 		cb = best_match->cb;
 		user_data = best_match->user_data;
 	}
 
-	k_mutex_unlock(&conn_lock);
+	conn_lookup_unlock();
 
-	if (is_mcast_pkt && mcast_pkt_delivered) {
+	if (lookup.is_mcast_pkt && lookup.mcast_pkt_delivered) {
 		/* As one or more multicast packets
 		 * have already been delivered in the loop above,
 		 * we shall not call the callback again here.
@@ -1083,7 +1437,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 	NET_DBG("No match found.");
 
 	if ((pkt_family == AF_INET || pkt_family == AF_INET6) &&
-	    !(is_mcast_pkt || is_bcast_pkt)) {
+	    !(lookup.is_mcast_pkt || is_bcast_pkt)) {
 		if (IS_ENABLED(CONFIG_NET_TCP) && proto == IPPROTO_TCP &&
 		    IS_ENABLED(CONFIG_NET_TCP_REJECT_CONN_WITH_RST)) {
 			net_tcp_reply_rst(pkt);
@@ -1119,6 +1473,14 @@ void net_conn_init(void)
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
 
+#if defined(CONFIG_NET_CONN_HASH)
+	for (i = 0; i < ARRAY_SIZE(conn_buckets); i++) {
+		sys_slist_init(&conn_buckets[i]);
+	}
+
+	sys_slist_init(&conn_wildcard);
+#endif
+
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
 	}
@@ -16,6 +16,7 @@
 #include <zephyr/types.h>
 
 #include <zephyr/sys/util.h>
+#include <zephyr/kernel/rcu.h>
 
 #include <zephyr/net/net_context.h>
 #include <zephyr/net/net_core.h>
@@ -85,6 +86,25 @@ struct net_conn {
 
 	/** Is v4-mapping-to-v6 enabled for this connection */
 	uint8_t v6only : 1;
+
+#if defined(CONFIG_NET_CONN_HASH)
+	/** Internal slist node in the index of the connection */
+	sys_snode_t index_node;
+
+	/** List of the index the connection is in, if any */
+	sys_slist_t *index;
+
+	/** Registration order, newer connections win ties */
+	uint32_t seq;
+#endif
+
+#if defined(CONFIG_NET_CONN_RCU)
+	/** Indexes again or recycles the connection after a grace period */
+	struct k_rcu_head rcu;
+
+	/** Is the RCU callback pending */
+	uint8_t rcu_pending : 1;
+#endif
 };
 
 /**
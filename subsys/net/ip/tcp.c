@@ -12,12 +12,15 @@ LOG_MODULE_REGISTER(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
 #include <stdlib.h>
 #include <zephyr/kernel.h>
 #include <zephyr/random/random.h>
+#include <zephyr/kernel/rcu.h>
+#include <zephyr/sys/hash_function.h>
 
 #if defined(CONFIG_NET_TCP_ISN_RFC6528)
 #include <psa/crypto.h>
 #endif
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_context.h>
+#include <zephyr/net/socket.h>
 #include <zephyr/net/udp.h>
 #include "ipv4.h"
 #include "ipv6.h"
@@ -59,11 +62,12 @@ static int tcp_tx_window =
 	CONFIG_NET_PKT_BUF_TX_DATA_POOL_SIZE / 3;
 #endif /* CONFIG_NET_BUF_FIXED_DATA_SIZE */
 #endif
-#ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
+#if defined(CONFIG_NET_TCP_RANDOMIZED_RTO) || defined(CONFIG_NET_TCP_TIMESTAMPS)
 #define TCP_RTO_MS (conn->rto)
 #else
 #define TCP_RTO_MS (tcp_rto)
 #endif
+#define TCP_RTO_MAX_MS 60000 /* RFC 6298, ch 2.5 */
 
 /* Define the number of MSS sections the congestion window is initialized at */
 #define TCP_CONGESTION_INITIAL_WIN 1
@@ -82,6 +86,7 @@ static K_KERNEL_STACK_DEFINE(work_q_stack, CONFIG_NET_TCP_WORKQ_STACK_SIZE);
 static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt);
 static bool is_destination_local(struct net_pkt *pkt);
 static void tcp_out(struct tcp *conn, uint8_t flags);
+static int tcp_send_data(struct tcp *conn);
 static const char *tcp_state_to_str(enum tcp_state state, bool prefix);
 
 int (*tcp_send_cb)(struct net_pkt *pkt) = NULL;
@@ -240,6 +245,79 @@ static int tcp_endpoint_set(union tcp_endpoint *ep, struct net_pkt *pkt,
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP_CONN_HASH)
+/* Lists of the connections by the hash of their 4-tuple, read with
+ * tcp_conn_lookup_lock() held and updated with tcp_lock held.
+ */
+static sys_slist_t tcp_conn_buckets[CONFIG_NET_TCP_CONN_HASH_BUCKETS];
+
+static sys_slist_t *tcp_conn_bucket(const union tcp_endpoint *local,
+				    const union tcp_endpoint *remote)
+{
+	size_t len = tcp_endpoint_len(local->sa.sa_family);
+	uint32_t hash = sys_hash32(local, len) * 31U + sys_hash32(remote, len);
+
+	return &tcp_conn_buckets[hash % CONFIG_NET_TCP_CONN_HASH_BUCKETS];
+}
+
+/* Must be called with tcp_lock held, once the endpoints of conn are set */
+static void tcp_conn_hash_add(struct tcp *conn)
+{
+	__ASSERT_NO_MSG(conn->bucket == NULL);
+
+	conn->bucket = tcp_conn_bucket(&conn->src, &conn->dst);
+	k_rcu_slist_prepend(conn->bucket, &conn->hash_node);
+}
+
+/* Must be called with tcp_lock held */
+static void tcp_conn_hash_del(struct tcp *conn)
+{
+	if (conn->bucket == NULL) {
+		return;
+	}
+
+	k_rcu_slist_find_and_remove(conn->bucket, &conn->hash_node);
+	conn->bucket = NULL;
+}
+
+/* Must be called with tcp_conn_lookup_lock() held */
+static struct tcp *tcp_conn_hash_find(struct net_pkt *pkt)
+{
+	union tcp_endpoint local;
+	union tcp_endpoint remote;
+	sys_slist_t *bucket;
+	struct tcp *conn;
+	size_t len;
+
+	if (tcp_endpoint_set(&local, pkt, TCP_EP_DST) < 0 ||
+	    tcp_endpoint_set(&remote, pkt, TCP_EP_SRC) < 0) {
+		return NULL;
+	}
+
+	bucket = tcp_conn_bucket(&local, &remote);
+	len = tcp_endpoint_len(local.sa.sa_family);
+
+	K_RCU_SLIST_FOR_EACH_CONTAINER(bucket, conn, hash_node) {
+		if (!memcmp(&conn->src, &local, len) &&
+		    !memcmp(&conn->dst, &remote, len)) {
+			return conn;
+		}
+	}
+
+	return NULL;
+}
+#else
+static inline void tcp_conn_hash_add(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static inline void tcp_conn_hash_del(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+}
+#endif /* CONFIG_NET_TCP_CONN_HASH */
+
 int net_tcp_endpoint_copy(struct net_context *ctx,
 			  struct sockaddr *local,
 			  struct sockaddr *peer,
@@ -421,6 +499,18 @@ out:
 
 static void tcp_derive_rto(struct tcp *conn)
 {
+#if defined(CONFIG_NET_TCP_TIMESTAMPS)
+	if (conn->rtt_sampled) {
+		/* RFC 6298, ch 2.3, with a clock granularity of 1 ms. As the
+		 * rttvar is kept scaled by 4, it is K * RTTVAR already.
+		 */
+		uint32_t rto = (conn->srtt >> 3) + MAX(conn->rttvar, 1U);
+
+		conn->rto = (uint16_t)CLAMP(rto, CONFIG_NET_TCP_MIN_RETRANSMISSION_TIMEOUT,
+					    TCP_RTO_MAX_MS);
+		return;
+	}
+#endif
 #ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
 	/* Compute a randomized rto 1 and 1.5 times tcp_rto */
 	uint32_t gain;
@@ -436,6 +526,8 @@ static void tcp_derive_rto(struct tcp *conn)
 	rto = (uint32_t)tcp_rto;
 	rto = (gain * rto) >> 9;
 	conn->rto = (uint16_t)rto;
+#elif defined(CONFIG_NET_TCP_TIMESTAMPS)
+	conn->rto = (uint16_t)tcp_rto;
 #else
 	ARG_UNUSED(conn);
 #endif
@@ -752,6 +844,15 @@ static void tcp_send_queue_flush(struct tcp *conn)
 	}
 }
 
+#if defined(CONFIG_NET_CONN_RCU)
+static void tcp_conn_free(struct k_rcu_head *head)
+{
+	struct tcp *conn = CONTAINER_OF(head, struct tcp, rcu);
+
+	k_mem_slab_free(&tcp_conns_slab, (void *)conn);
+}
+#endif /* CONFIG_NET_CONN_RCU */
+
 static void tcp_conn_release(struct k_work *work)
 {
 	struct tcp *conn = CONTAINER_OF(work, struct tcp, conn_release);
@@ -814,10 +915,20 @@ static void tcp_conn_release(struct k_work *work)
 	conn->context = NULL;
 
 	k_mutex_lock(&tcp_lock, K_FOREVER);
-	sys_slist_find_and_remove(&tcp_conns, &conn->next);
+	tcp_conn_hash_del(conn);
+#if defined(CONFIG_NET_TCP_CONN_HASH) && defined(CONFIG_NET_CONN_RCU)
+	/* A pending tcp_conn_rehash() runs before tcp_conn_free() */
+	conn->rehash_index = false;
+#endif
+	k_rcu_slist_find_and_remove(&tcp_conns, &conn->next);
 	k_mutex_unlock(&tcp_lock);
 
+#if defined(CONFIG_NET_CONN_RCU)
+	/* A lookup may still be looking at conn, which is unreachable now */
+	k_rcu_call(&conn->rcu, tcp_conn_free);
+#else
 	k_mem_slab_free(&tcp_conns_slab, (void *)conn);
+#endif /* CONFIG_NET_CONN_RCU */
 }
 
 #if defined(CONFIG_NET_TEST)
@@ -1009,9 +1120,6 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	NET_DBG("len=%zd", len);
 
-	recv_options->mss_found = false;
-	recv_options->wnd_found = false;
-
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
 
@@ -1059,6 +1167,46 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+#if defined(CONFIG_NET_TCP_SACK)
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+		case NET_TCP_SACK_OPT:
+			if (opt_len < NET_TCP_SACK_SIZE + NET_TCP_SACK_BLOCK_SIZE ||
+			    ((opt_len - NET_TCP_SACK_SIZE) % NET_TCP_SACK_BLOCK_SIZE) != 0) {
+				result = false;
+				goto end;
+			}
+
+			for (int i = NET_TCP_SACK_SIZE;
+			     i < opt_len && recv_options->sack_num < TCP_SACK_MAX_BLOCKS;
+			     i += NET_TCP_SACK_BLOCK_SIZE) {
+				struct tcp_sack_block *block =
+					&recv_options->sack[recv_options->sack_num++];
+
+				block->left = ntohl(UNALIGNED_GET((uint32_t *)(options + i)));
+				block->right = ntohl(UNALIGNED_GET((uint32_t *)(options + i + 4)));
+				NET_DBG("SACK %u-%u", block->left, block->right);
+			}
+			break;
+#endif /* CONFIG_NET_TCP_SACK */
+#if defined(CONFIG_NET_TCP_TIMESTAMPS)
+		case NET_TCP_TIMESTAMP_OPT:
+			if (opt_len != NET_TCP_TIMESTAMP_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->tsval = ntohl(UNALIGNED_GET((uint32_t *)(options + 2)));
+			recv_options->tsecr = ntohl(UNALIGNED_GET((uint32_t *)(options + 6)));
+			recv_options->ts_found = true;
+			break;
+#endif /* CONFIG_NET_TCP_TIMESTAMPS */
 		default:
 			continue;
 		}
@@ -1071,6 +1219,456 @@ end:
 	return result;
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+
+/* SACK is permitted if the peer offered it in its SYN, as we always do */
+static void tcp_sack_negotiate(struct tcp *conn)
+{
+	conn->sack_ok = conn->recv_options.sack_perm_found;
+	conn->snd_max = conn->seq;
+
+	NET_DBG("[%p] SACK %s", conn, conn->sack_ok ? "permitted" : "not permitted");
+}
+
+/* The out-of-order data we hold is a single contiguous run, so it is
+ * reported as a single block.
+ */
+static bool tcp_sack_queued_block(struct tcp *conn, struct tcp_sack_block *block)
+{
+	if (!CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT ||
+	    net_pkt_is_empty(conn->queue_recv_data)) {
+		return false;
+	}
+
+	block->left = tcp_get_seq(conn->queue_recv_data->buffer);
+	block->right = block->left + net_pkt_get_len(conn->queue_recv_data);
+
+	return net_tcp_seq_cmp(block->left, conn->ack) > 0;
+}
+
+static size_t tcp_sack_options_len(struct tcp *conn, uint8_t flags)
+{
+	struct tcp_sack_block block;
+
+	if (flags & SYN) {
+		/* Always offered, only agreed to if the peer offered it */
+		if (!(flags & ACK) || conn->sack_ok) {
+			return 2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_PERM_SIZE;
+		}
+
+		return 0;
+	}
+
+	if (!conn->sack_ok || !(flags & ACK) || (flags & RST) ||
+	    !tcp_sack_queued_block(conn, &block)) {
+		return 0;
+	}
+
+	return 2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_SIZE + NET_TCP_SACK_BLOCK_SIZE;
+}
+
+static int tcp_sack_options_add(struct tcp *conn, uint8_t flags, struct net_pkt *pkt)
+{
+	uint8_t opts[2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_SIZE + NET_TCP_SACK_BLOCK_SIZE];
+	size_t len = tcp_sack_options_len(conn, flags);
+	struct tcp_sack_block block;
+
+	if (len == 0) {
+		return 0;
+	}
+
+	opts[0] = NET_TCP_NOP_OPT;
+	opts[1] = NET_TCP_NOP_OPT;
+
+	if (flags & SYN) {
+		opts[2] = NET_TCP_SACK_PERM_OPT;
+		opts[3] = NET_TCP_SACK_PERM_SIZE;
+	} else {
+		(void)tcp_sack_queued_block(conn, &block);
+
+		opts[2] = NET_TCP_SACK_OPT;
+		opts[3] = NET_TCP_SACK_SIZE + NET_TCP_SACK_BLOCK_SIZE;
+		UNALIGNED_PUT(htonl(block.left), (uint32_t *)&opts[4]);
+		UNALIGNED_PUT(htonl(block.right), (uint32_t *)&opts[8]);
+	}
+
+	return net_pkt_write(pkt, opts, len);
+}
+
+/* Add a block to the scoreboard, merging it with the blocks it overlaps
+ * or touches. If the scoreboard is full, the highest block is forgotten,
+ * as the lowest ones are the first to be retransmitted around.
+ */
+static void tcp_sack_insert(struct tcp *conn, uint32_t left, uint32_t right)
+{
+	struct tcp_sack_block *sacked = conn->sacked;
+	int num = conn->sacked_num;
+	int i = 0;
+	int j;
+
+	while (i < num && net_tcp_seq_cmp(sacked[i].right, left) < 0) {
+		i++;
+	}
+
+	for (j = i; j < num && net_tcp_seq_cmp(sacked[j].left, right) <= 0; j++) {
+		if (net_tcp_seq_cmp(sacked[j].left, left) < 0) {
+			left = sacked[j].left;
+		}
+
+		if (net_tcp_seq_cmp(sacked[j].right, right) > 0) {
+			right = sacked[j].right;
+		}
+	}
+
+	if (j > i) {
+		/* Blocks i to j - 1 become a single one */
+		memmove(&sacked[i + 1], &sacked[j], (num - j) * sizeof(*sacked));
+		num -= j - i - 1;
+	} else {
+		if (num == TCP_SACK_MAX_BLOCKS) {
+			if (i == num) {
+				return;
+			}
+
+			num--;
+		}
+
+		memmove(&sacked[i + 1], &sacked[i], (num - i) * sizeof(*sacked));
+		num++;
+	}
+
+	sacked[i].left = left;
+	sacked[i].right = right;
+	conn->sacked_num = num;
+}
+
+/* Record the blocks of the last received segment */
+static void tcp_sack_update(struct tcp *conn)
+{
+	struct tcp_options *options = &conn->recv_options;
+	uint32_t sent_end = conn->snd_max;
+
+	if (!conn->sack_ok) {
+		return;
+	}
+
+	if (net_tcp_seq_cmp(sent_end, conn->seq) < 0) {
+		sent_end = conn->seq;
+	}
+
+	for (int i = 0; i < options->sack_num; i++) {
+		uint32_t left = options->sack[i].left;
+		uint32_t right = options->sack[i].right;
+
+		if (net_tcp_seq_cmp(left, conn->seq) < 0) {
+			left = conn->seq;
+		}
+
+		/* Ignore what was acknowledged already, or never sent */
+		if (net_tcp_seq_cmp(right, left) <= 0 ||
+		    net_tcp_seq_cmp(right, sent_end) > 0) {
+			continue;
+		}
+
+		tcp_sack_insert(conn, left, right);
+	}
+
+	/* Only apply them once */
+	options->sack_num = 0;
+}
+
+/* Keep track of the end of the data sent so far, which a retransmission
+ * timeout does not move back.
+ */
+static void tcp_sack_sent(struct tcp *conn)
+{
+	uint32_t end = conn->seq + conn->unacked_len;
+
+	if (net_tcp_seq_cmp(end, conn->snd_max) > 0) {
+		conn->snd_max = end;
+	}
+}
+
+/* Forget the blocks the cumulative acknowledgment now covers */
+static void tcp_sack_acked(struct tcp *conn)
+{
+	struct tcp_sack_block *sacked = conn->sacked;
+	int i = 0;
+
+	while (i < conn->sacked_num &&
+	       net_tcp_seq_cmp(sacked[i].right, conn->seq) <= 0) {
+		i++;
+	}
+
+	memmove(sacked, &sacked[i], (conn->sacked_num - i) * sizeof(*sacked));
+	conn->sacked_num -= i;
+
+	if (conn->sacked_num > 0 && net_tcp_seq_cmp(sacked[0].left, conn->seq) < 0) {
+		sacked[0].left = conn->seq;
+	}
+}
+
+/* After a retransmission timeout, the peer may have discarded the data it
+ * selectively acknowledged, so everything is sent again (RFC 2018, ch 8).
+ */
+static void tcp_sack_reset(struct tcp *conn)
+{
+	conn->sacked_num = 0;
+}
+
+/* Offset in send_data of the first byte from offset the peer is missing */
+static int tcp_sack_skip(struct tcp *conn, int offset)
+{
+	for (int i = 0; i < conn->sacked_num; i++) {
+		int left = conn->sacked[i].left - conn->seq;
+		int right = conn->sacked[i].right - conn->seq;
+
+		if (offset < left) {
+			break;
+		}
+
+		if (offset < right) {
+			offset = right;
+		}
+	}
+
+	return offset;
+}
+
+/* Limit a segment starting at offset to the hole it starts in */
+static int tcp_sack_hole_len(struct tcp *conn, int offset, int len)
+{
+	for (int i = 0; i < conn->sacked_num; i++) {
+		int left = conn->sacked[i].left - conn->seq;
+
+		if (offset < left) {
+			return MIN(len, left - offset);
+		}
+	}
+
+	return len;
+}
+
+/* On fast retransmit, send the first segment of every hole between the
+ * selectively acknowledged blocks, the first hole being sent already.
+ * The data after the highest block is not known to be lost, so it is
+ * left to the retransmission timer.
+ */
+static void tcp_sack_resend_holes(struct tcp *conn)
+{
+	for (int i = 0; i + 1 < conn->sacked_num; i++) {
+		conn->unacked_len = conn->sacked[i].right - conn->seq;
+		(void)tcp_send_data(conn);
+	}
+}
+
+#else /* CONFIG_NET_TCP_SACK */
+
+static void tcp_sack_negotiate(struct tcp *conn) { }
+
+static size_t tcp_sack_options_len(struct tcp *conn, uint8_t flags)
+{
+	return 0;
+}
+
+static int tcp_sack_options_add(struct tcp *conn, uint8_t flags, struct net_pkt *pkt)
+{
+	return 0;
+}
+
+static void tcp_sack_update(struct tcp *conn) { }
+
+static void tcp_sack_sent(struct tcp *conn) { }
+
+static void tcp_sack_acked(struct tcp *conn) { }
+
+static void tcp_sack_reset(struct tcp *conn) { }
+
+static int tcp_sack_skip(struct tcp *conn, int offset)
+{
+	return offset;
+}
+
+static int tcp_sack_hole_len(struct tcp *conn, int offset, int len)
+{
+	return len;
+}
+
+static void tcp_sack_resend_holes(struct tcp *conn) { }
+
+#endif /* CONFIG_NET_TCP_SACK */
+
+#if defined(CONFIG_NET_TCP_TIMESTAMPS)
+
+static uint32_t tcp_ts_now(struct tcp *conn)
+{
+	return k_uptime_get_32() + conn->ts_offset;
+}
+
+/* Timestamps are used if the peer offered them in its SYN, as we always do */
+static void tcp_ts_negotiate(struct tcp *conn)
+{
+	conn->ts_ok = conn->recv_options.ts_found;
+
+	NET_DBG("[%p] timestamps %s", conn, conn->ts_ok ? "used" : "not used");
+}
+
+static size_t tcp_ts_options_len(struct tcp *conn, uint8_t flags)
+{
+	/* Offered in every SYN, then sent in all the segments but RST */
+	if ((flags & RST) || (!conn->ts_ok && (flags & (SYN | ACK)) != SYN)) {
+		return 0;
+	}
+
+	return 2 * NET_TCP_NOP_SIZE + NET_TCP_TIMESTAMP_SIZE;
+}
+
+static int tcp_ts_options_add(struct tcp *conn, uint8_t flags, struct net_pkt *pkt)
+{
+	uint8_t opts[2 * NET_TCP_NOP_SIZE + NET_TCP_TIMESTAMP_SIZE];
+	size_t len = tcp_ts_options_len(conn, flags);
+
+	if (len == 0) {
+		return 0;
+	}
+
+	opts[0] = NET_TCP_NOP_OPT;
+	opts[1] = NET_TCP_NOP_OPT;
+	opts[2] = NET_TCP_TIMESTAMP_OPT;
+	opts[3] = NET_TCP_TIMESTAMP_SIZE;
+	UNALIGNED_PUT(htonl(tcp_ts_now(conn)), (uint32_t *)&opts[4]);
+	/* There is nothing to echo yet in our SYN */
+	UNALIGNED_PUT(htonl((flags & ACK) ? conn->ts_recent : 0U), (uint32_t *)&opts[8]);
+
+	return net_pkt_write(pkt, opts, len);
+}
+
+/* Returns false if the segment carries an older timestamp than the last
+ * one received, i.e. is an old duplicate to be dropped (RFC 7323, ch 5).
+ */
+static bool tcp_ts_check(struct tcp *conn, uint32_t seq, uint8_t flags)
+{
+	struct tcp_options *options = &conn->recv_options;
+
+	if (!options->ts_found) {
+		return true;
+	}
+
+	if (conn->state == TCP_LISTEN || conn->state == TCP_SYN_SENT) {
+		conn->ts_recent = options->tsval;
+		return true;
+	}
+
+	if (!conn->ts_ok) {
+		return true;
+	}
+
+	if ((int32_t)(options->tsval - conn->ts_recent) < 0) {
+		/* A RST is processed anyway */
+		return (flags & RST) != 0;
+	}
+
+	/* Echo the timestamp of the oldest segment we have not acknowledged
+	 * yet (RFC 7323, ch 4.3).
+	 */
+	if (net_tcp_seq_cmp(seq, conn->ack) <= 0) {
+		conn->ts_recent = options->tsval;
+	}
+
+	return true;
+}
+
+/* Update the round-trip time estimates with a new sample, as described
+ * in RFC 6298, ch 2. The srtt is kept scaled by 8 and the rttvar by 4, so
+ * that the gains of 1/8 and 1/4 do not lose the precision of the sample.
+ */
+static void tcp_rtt_sample(struct tcp *conn, uint32_t rtt)
+{
+	if (!conn->rtt_sampled) {
+		conn->srtt = rtt << 3;
+		conn->rttvar = rtt << 1;
+		conn->rtt_sampled = true;
+	} else {
+		int32_t delta = (int32_t)rtt - (int32_t)(conn->srtt >> 3);
+
+		conn->srtt += delta;
+		conn->rttvar += abs(delta) - (conn->rttvar >> 2);
+	}
+
+	tcp_derive_rto(conn);
+
+	NET_DBG("[%p] rtt=%u srtt=%u rttvar=%u rto=%u", conn, rtt,
+		conn->srtt >> 3, conn->rttvar >> 2, conn->rto);
+}
+
+/* An acknowledgment of new data echoes the timestamp of the segment it
+ * was sent for, which gives a round-trip time sample (RFC 7323, ch 4.1).
+ */
+static void tcp_ts_rtt_sample(struct tcp *conn)
+{
+	struct tcp_options *options = &conn->recv_options;
+	uint32_t rtt;
+
+	if (!conn->ts_ok || !options->ts_found || options->tsecr == 0U) {
+		return;
+	}
+
+	rtt = tcp_ts_now(conn) - options->tsecr;
+	if (rtt > TCP_RTO_MAX_MS) {
+		/* Not an echo of anything we sent recently */
+		return;
+	}
+
+	tcp_rtt_sample(conn, rtt);
+}
+
+#else /* CONFIG_NET_TCP_TIMESTAMPS */
+
+static void tcp_ts_negotiate(struct tcp *conn) { }
+
+static size_t tcp_ts_options_len(struct tcp *conn, uint8_t flags)
+{
+	return 0;
+}
+
+static int tcp_ts_options_add(struct tcp *conn, uint8_t flags, struct net_pkt *pkt)
+{
+	return 0;
+}
+
+static bool tcp_ts_check(struct tcp *conn, uint32_t seq, uint8_t flags)
+{
+	return true;
+}
+
+static void tcp_ts_rtt_sample(struct tcp *conn) { }
+
+#endif /* CONFIG_NET_TCP_TIMESTAMPS */
+
+/* Forget the options of the previous segment that only applied to it */
+static void tcp_options_reset(struct tcp_options *recv_options)
+{
+#if defined(CONFIG_NET_TCP_SACK)
+	recv_options->sack_num = 0;
+	recv_options->sack_perm_found = false;
+#endif
+#if defined(CONFIG_NET_TCP_TIMESTAMPS)
+	recv_options->ts_found = false;
+#endif
+}
+
+static void tcp_options_negotiate(struct tcp *conn)
+{
+	tcp_sack_negotiate(conn);
+	tcp_ts_negotiate(conn);
+}
+
+/* Length of the options sent after the MSS one */
+static size_t tcp_options_len(struct tcp *conn, uint8_t flags)
+{
+	return tcp_sack_options_len(conn, flags) + tcp_ts_options_len(conn, flags);
+}
+
 static bool tcp_short_window(struct tcp *conn)
 {
 	int32_t threshold = MIN(conn_mss(conn), conn->recv_win_max / 2);
@@ -1270,6 +1868,8 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 		th->th_off++;
 	}
 
+	th->th_off += tcp_options_len(conn, flags) / 4;
+
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(htons(conn->recv_win), UNALIGNED_MEMBER_ADDR(th, th_win));
 	UNALIGNED_PUT(htonl(seq), UNALIGNED_MEMBER_ADDR(th, th_seq));
@@ -1329,6 +1929,45 @@ static int get_tcp_nodelay(struct tcp *conn, void *value, size_t *len)
 	return 0;
 }
 
+static int get_tcp_info(struct tcp *conn, void *value, size_t *len)
+{
+	struct tcp_info *info = value;
+
+	if (value == NULL || len == NULL || *len < sizeof(struct tcp_info)) {
+		return -EINVAL;
+	}
+
+	memset(info, 0, sizeof(*info));
+
+#if defined(CONFIG_NET_TCP_TIMESTAMPS)
+	if (conn->ts_ok) {
+		info->tcpi_options |= TCPI_OPT_TIMESTAMPS;
+	}
+
+	if (conn->rtt_sampled) {
+		info->tcpi_rtt = (conn->srtt * USEC_PER_MSEC) >> 3;
+		info->tcpi_rttvar = (conn->rttvar * USEC_PER_MSEC) >> 2;
+	}
+#endif
+#if defined(CONFIG_NET_TCP_SACK)
+	if (conn->sack_ok) {
+		info->tcpi_options |= TCPI_OPT_SACK;
+	}
+#endif
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+	info->tcpi_snd_cwnd = conn->ca.cwnd;
+#endif
+	info->tcpi_retransmits = conn->send_data_retries;
+	info->tcpi_rto = TCP_RTO_MS * USEC_PER_MSEC;
+	info->tcpi_snd_mss = conn_mss(conn);
+	info->tcpi_rcv_mss = net_tcp_get_supported_mss(conn);
+	info->tcpi_snd_wnd = conn->send_win;
+
+	*len = sizeof(*info);
+
+	return 0;
+}
+
 static int net_tcp_set_mss_opt(struct tcp *conn, struct net_pkt *pkt)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(mss_opt_access, struct tcp_mss_option);
@@ -1468,6 +2107,8 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		alloc_len += sizeof(uint32_t);
 	}
 
+	alloc_len += tcp_options_len(conn, flags);
+
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1500,6 +2141,18 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	ret = tcp_sack_options_add(conn, flags, pkt);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		goto out;
+	}
+
+	ret = tcp_ts_options_add(conn, flags, pkt);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		goto out;
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1723,7 +2376,12 @@ static int tcp_send_data(struct tcp *conn)
 	int len;
 	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+	/* Do not send again what the peer has selectively acknowledged */
+	conn->unacked_len = tcp_sack_skip(conn, conn->unacked_len);
+
+	/* The MSS does not account for the options, so leave room for them */
+	len = MIN(tcp_unsent_len(conn),
+		  conn_mss(conn) - (int)tcp_options_len(conn, PSH | ACK));
 	if (len < 0) {
 		ret = len;
 		goto out;
@@ -1734,6 +2392,8 @@ static int tcp_send_data(struct tcp *conn)
 		goto out;
 	}
 
+	len = tcp_sack_hole_len(conn, conn->unacked_len, len);
+
 	pkt = tcp_pkt_alloc(conn, len);
 	if (!pkt) {
 		NET_ERR("[%p] packet allocation failed, len=%d", conn, len);
@@ -1751,6 +2411,7 @@ static int tcp_send_data(struct tcp *conn)
 	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
 	if (ret == 0) {
 		conn->unacked_len += len;
+		tcp_sack_sent(conn);
 
 		if (conn->data_mode == TCP_DATA_MODE_RESEND) {
 			net_stats_update_tcp_resent(conn->iface, len);
@@ -1874,6 +2535,7 @@ static void tcp_resend_data(struct k_work *work)
 
 		conn->data_mode = TCP_DATA_MODE_RESEND;
 		conn->unacked_len = 0;
+		tcp_sack_reset(conn);
 
 		ret = tcp_send_data(conn);
 		if (ret == -ENODATA) {
@@ -2069,6 +2731,23 @@ static void tcp_conn_ref(struct tcp *conn)
 	NET_DBG("[%p] ref_count: %d", conn, ref_count);
 }
 
+/* Take a reference to conn unless it is already being released */
+static bool tcp_conn_tryref(struct tcp *conn)
+{
+	atomic_val_t ref_count;
+
+	do {
+		ref_count = atomic_get(&conn->ref_count);
+		if (ref_count == 0) {
+			return false;
+		}
+	} while (!atomic_cas(&conn->ref_count, ref_count, ref_count + 1));
+
+	NET_DBG("[%p] ref_count: %d", conn, (int)ref_count + 1);
+
+	return true;
+}
+
 static struct tcp *tcp_conn_alloc(void)
 {
 	struct tcp *conn = NULL;
@@ -2111,6 +2790,9 @@ static struct tcp *tcp_conn_alloc(void)
 	conn->send_win = conn->send_win_max;
 	conn->tcp_nodelay = false;
 	conn->addr_ref_done = false;
+#if defined(CONFIG_NET_TCP_TIMESTAMPS)
+	conn->ts_offset = sys_rand32_get();
+#endif
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	conn->dup_ack_cnt = 0;
 #endif
@@ -2141,7 +2823,7 @@ static struct tcp *tcp_conn_alloc(void)
 	tcp_conn_ref(conn);
 
 	k_mutex_lock(&tcp_lock, K_FOREVER);
-	sys_slist_append(&tcp_conns, &conn->next);
+	k_rcu_slist_append(&tcp_conns, &conn->next);
 	k_mutex_unlock(&tcp_lock);
 out:
 	NET_DBG("[%p] Allocated", conn);
@@ -2176,6 +2858,7 @@ int net_tcp_get(struct net_context *context)
 	return ret;
 }
 
+#if !defined(CONFIG_NET_TCP_CONN_HASH) || defined(CONFIG_NET_CONN_RCU)
 static bool tcp_endpoint_cmp(union tcp_endpoint *ep, struct net_pkt *pkt,
 			     enum pkt_addr which)
 {
@@ -2194,26 +2877,172 @@ static bool tcp_conn_cmp(struct tcp *conn, struct net_pkt *pkt)
 		tcp_endpoint_cmp(&conn->dst, pkt, TCP_EP_SRC);
 }
 
+/* Must be called with tcp_conn_lookup_lock() held */
+static struct tcp *tcp_conn_list_find(struct net_pkt *pkt)
+{
+	struct tcp *conn;
+
+	K_RCU_SLIST_FOR_EACH_CONTAINER(&tcp_conns, conn, next) {
+		if (tcp_conn_cmp(conn, pkt)) {
+			return conn;
+		}
+	}
+
+	return NULL;
+}
+#endif /* !CONFIG_NET_TCP_CONN_HASH || CONFIG_NET_CONN_RCU */
+
+#if defined(CONFIG_NET_TCP_CONN_HASH) && defined(CONFIG_NET_CONN_RCU)
+/* Number of connections taken out of the hash table until no lookup can be
+ * in their old bucket any more. Meanwhile, they are only found on the list.
+ */
+static atomic_t tcp_conns_rehashing;
+
+static struct tcp *tcp_conn_find(struct net_pkt *pkt)
+{
+	struct tcp *conn = tcp_conn_hash_find(pkt);
+
+	if (conn == NULL) {
+		/* The count is raised before a connection leaves its bucket */
+		barrier_dmem_fence_full();
+
+		if (atomic_get(&tcp_conns_rehashing) > 0) {
+			conn = tcp_conn_list_find(pkt);
+		}
+	}
+
+	return conn;
+}
+#elif defined(CONFIG_NET_TCP_CONN_HASH)
+static struct tcp *tcp_conn_find(struct net_pkt *pkt)
+{
+	return tcp_conn_hash_find(pkt);
+}
+#else
+static struct tcp *tcp_conn_find(struct net_pkt *pkt)
+{
+	return tcp_conn_list_find(pkt);
+}
+#endif /* CONFIG_NET_TCP_CONN_HASH && CONFIG_NET_CONN_RCU */
+
+#if defined(CONFIG_NET_CONN_RCU)
+/* Connections are only freed after an RCU grace period, so segments of
+ * different connections can be looked up in parallel, without tcp_lock.
+ */
+static inline void tcp_conn_lookup_lock(void)
+{
+	k_rcu_read_lock();
+}
+
+static inline void tcp_conn_lookup_unlock(void)
+{
+	k_rcu_read_unlock();
+}
+#else
+/* The lookups of all the connections are serialized on tcp_lock */
+static inline void tcp_conn_lookup_lock(void)
+{
+	k_mutex_lock(&tcp_lock, K_FOREVER);
+}
+
+static inline void tcp_conn_lookup_unlock(void)
+{
+	k_mutex_unlock(&tcp_lock);
+}
+#endif /* CONFIG_NET_CONN_RCU */
+
+/* Find the connection of pkt. It is returned with a reference held, to be
+ * dropped with tcp_conn_unref().
+ */
 static struct tcp *tcp_conn_search(struct net_pkt *pkt)
 {
-	bool found = false;
 	struct tcp *conn;
-	struct tcp *tmp;
+
+	tcp_conn_lookup_lock();
+
+	conn = tcp_conn_find(pkt);
+	if (conn != NULL && !tcp_conn_tryref(conn)) {
+		conn = NULL;
+	}
+
+	tcp_conn_lookup_unlock();
+
+	return conn;
+}
+
+#if defined(CONFIG_NET_TCP_CONN_HASH) && defined(CONFIG_NET_CONN_RCU)
+static void tcp_conn_rehash(struct k_rcu_head *head)
+{
+	struct tcp *conn = CONTAINER_OF(head, struct tcp, rehash);
 
 	k_mutex_lock(&tcp_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&tcp_conns, conn, tmp, next) {
-		found = tcp_conn_cmp(conn, pkt);
-		if (found) {
-			break;
-		}
+	conn->rehash_pending = false;
+
+	if (conn->rehash_index) {
+		conn->rehash_index = false;
+		tcp_conn_hash_add(conn);
 	}
 
 	k_mutex_unlock(&tcp_lock);
 
-	return found ? conn : NULL;
+	atomic_dec(&tcp_conns_rehashing);
 }
 
+/* Index conn by its 4-tuple, once its endpoints are set */
+static void tcp_conn_index(struct tcp *conn)
+{
+	k_mutex_lock(&tcp_lock, K_FOREVER);
+
+	if (conn->rehash_pending) {
+		/* Lookups may still go on from conn into its old bucket */
+		conn->rehash_index = true;
+	} else {
+		tcp_conn_hash_add(conn);
+	}
+
+	k_mutex_unlock(&tcp_lock);
+}
+
+/* Take conn out of the hash table before its endpoints change. It is only
+ * put back from an RCU callback, once the lookups in progress are done with
+ * its old bucket, so that connecting does not wait for them.
+ */
+static void tcp_conn_unindex(struct tcp *conn)
+{
+	k_mutex_lock(&tcp_lock, K_FOREVER);
+
+	conn->rehash_index = false;
+
+	if (conn->bucket != NULL) {
+		__ASSERT_NO_MSG(!conn->rehash_pending);
+
+		atomic_inc(&tcp_conns_rehashing);
+		tcp_conn_hash_del(conn);
+
+		conn->rehash_pending = true;
+		k_rcu_call(&conn->rehash, tcp_conn_rehash);
+	}
+
+	k_mutex_unlock(&tcp_lock);
+}
+#else
+/* Index conn by its 4-tuple, once its endpoints are set */
+static void tcp_conn_index(struct tcp *conn)
+{
+	k_mutex_lock(&tcp_lock, K_FOREVER);
+	tcp_conn_hash_add(conn);
+	k_mutex_unlock(&tcp_lock);
+}
+
+static void tcp_conn_unindex(struct tcp *conn)
+{
+	k_mutex_lock(&tcp_lock, K_FOREVER);
+	tcp_conn_hash_del(conn);
+	k_mutex_unlock(&tcp_lock);
+}
+#endif /* CONFIG_NET_TCP_CONN_HASH && CONFIG_NET_CONN_RCU */
+
 static struct tcp *tcp_conn_new(struct net_pkt *pkt);
 
 static enum net_verdict tcp_recv(struct net_conn *net_conn,
@@ -2231,7 +3060,10 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 
 	conn = tcp_conn_search(pkt);
 	if (conn) {
-		goto in;
+		verdict = tcp_in(conn, pkt);
+		tcp_conn_unref(conn);
+
+		return verdict;
 	}
 
 	th = th_get(pkt);
@@ -2400,6 +3232,8 @@ static struct tcp *tcp_conn_new(struct net_pkt *pkt)
 		goto err;
 	}
 
+	tcp_conn_index(conn);
+
 	NET_DBG("[%p] src: %s, dst: %s", conn,
 		net_sprint_addr(conn->src.sa.sa_family,
 				(const void *)&conn->src.sin.sin_addr),
@@ -2905,6 +3739,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto out;
 	}
 
+	tcp_options_reset(&conn->recv_options);
+
 	if (tcp_options_len && !tcp_options_check(&conn->recv_options, pkt,
 						  tcp_options_len)) {
 		NET_DBG("[%p] DROP: Invalid TCP option list", conn);
@@ -2914,6 +3750,14 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto out;
 	}
 
+	if (!tcp_ts_check(conn, th_seq(th), fl)) {
+		NET_DBG("[%p] DROP: Old timestamp", conn);
+		net_stats_update_tcp_seg_drop(conn->iface);
+		tcp_out(conn, ACK);
+		k_mutex_unlock(&conn->lock);
+		return NET_DROP;
+	}
+
 	if ((conn->state != TCP_LISTEN) && (conn->state != TCP_SYN_SENT) && FL(&fl, &, SYN)) {
 		/* According to RFC 793, ch 3.9 Event Processing, receiving SYN
 		 * once the connection has been established is an error
@@ -2993,6 +3837,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
+			tcp_options_negotiate(conn);
 			tcp_out(conn, SYN | ACK);
 			conn->send_options.mss_found = false;
 			conn_seq(conn, + 1);
@@ -3024,6 +3869,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 
 			k_work_cancel_delayable(&conn->establish_timer);
 			k_work_cancel_delayable(&conn->send_data_timer);
+			tcp_ts_rtt_sample(conn);
 			tcp_conn_ref(conn);
 			net_context_set_state(conn->context,
 					      NET_CONTEXT_CONNECTED);
@@ -3108,6 +3954,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			k_work_cancel_delayable(&conn->send_data_timer);
 			conn_ack(conn, th_seq(th) + 1);
+			tcp_options_negotiate(conn);
+			tcp_ts_rtt_sample(conn);
 			if (len) {
 				verdict = tcp_data_get(conn, pkt, &len);
 				if (verdict == NET_OK) {
@@ -3180,6 +4028,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		 */
 		keep_alive_timer_restart(conn);
 
+		tcp_sack_update(conn);
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3206,6 +4056,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				conn->unacked_len = 0;
 
 				(void)tcp_send_data(conn);
+				tcp_sack_resend_holes(conn);
 
 				/* Restore the current transmission */
 				conn->unacked_len = temp_unacked_len;
@@ -3258,6 +4109,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			}
 
 			conn_seq(conn, + len_acked);
+			tcp_sack_acked(conn);
+			tcp_ts_rtt_sample(conn);
 			net_stats_update_tcp_seg_recv(conn->iface);
 
 			/* Receipt of an acknowledgment that covers a sequence number
@@ -3831,6 +4684,9 @@ int net_tcp_connect(struct net_context *context,
 	conn->iface = net_context_get_iface(context);
 	tcp_derive_rto(conn);
 
+	/* The endpoints of a previous attempt are about to be replaced */
+	tcp_conn_unindex(conn);
+
 	switch (net_context_get_family(context)) {
 		const struct in_addr *ip4;
 		const struct in6_addr *ip6;
@@ -3912,6 +4768,8 @@ int net_tcp_connect(struct net_context *context,
 		net_sprint_addr(conn->dst.sa.sa_family,
 				(const void *)&conn->dst.sin.sin_addr));
 
+	tcp_conn_index(conn);
+
 	net_context_set_state(context, NET_CONTEXT_CONNECTING);
 
 	ret = net_conn_register(net_context_get_proto(context),
@@ -4138,7 +4996,15 @@ static enum net_verdict tcp_input(struct net_conn *net_conn,
 	if (th) {
 		struct tcp *conn = tcp_conn_search(pkt);
 
-		if (conn == NULL && SYN == th_flags(th)) {
+		if (conn) {
+			conn->iface = pkt->iface;
+			verdict = tcp_in(conn, pkt);
+			tcp_conn_unref(conn);
+
+			return verdict;
+		}
+
+		if (SYN == th_flags(th)) {
 			struct net_context *context =
 				tcp_calloc(1, sizeof(struct net_context));
 			net_tcp_get(context);
@@ -4146,6 +5012,7 @@ static enum net_verdict tcp_input(struct net_conn *net_conn,
 			conn = context->tcp;
 			tcp_endpoint_set(&conn->dst, pkt, TCP_EP_SRC);
 			tcp_endpoint_set(&conn->src, pkt, TCP_EP_DST);
+			tcp_conn_index(conn);
 			/* Make an extra reference, the sanity check suite
 			 * will delete the connection explicitly
 			 */
@@ -4210,6 +5077,15 @@ static void tcp_to_json(struct tcp *conn, void *data, size_t *data_len)
 	tp_encode(&tp, data, data_len);
 }
 
+/* Drop the reference taken by the lookup of tp_input(), if still held */
+static void tp_conn_put(struct tcp **conn)
+{
+	if (*conn != NULL) {
+		tcp_conn_unref(*conn);
+		*conn = NULL;
+	}
+}
+
 enum net_verdict tp_input(struct net_conn *net_conn,
 			  struct net_pkt *pkt,
 			  union net_ip_header *ip_hdr,
@@ -4218,7 +5094,8 @@ enum net_verdict tp_input(struct net_conn *net_conn,
 {
 	struct net_udp_hdr *uh = net_udp_get_hdr(pkt, NULL);
 	size_t data_len = ntohs(uh->len) - sizeof(*uh);
-	struct tcp *conn = tcp_conn_search(pkt);
+	struct tcp *found = tcp_conn_search(pkt);
+	struct tcp *conn = found;
 	size_t json_len = 0;
 	struct tp *tp;
 	struct tp_new *tp_new;
@@ -4281,6 +5158,8 @@ enum net_verdict tp_input(struct net_conn *net_conn,
 		}
 		if (is("CLOSE", tp->op)) {
 			tp_trace = false;
+			/* All the references to the connection are dropped */
+			tp_conn_put(&found);
 			{
 				struct net_context *context;
 
@@ -4298,6 +5177,8 @@ enum net_verdict tp_input(struct net_conn *net_conn,
 		if (is("CLOSE2", tp->op)) {
 			struct tcp *conn =
 				(void *)sys_slist_peek_head(&tcp_conns);
+
+			tp_conn_put(&found);
 			net_tcp_put(conn->context);
 		}
 		if (is("RECV", tp->op)) {
@@ -4353,6 +5234,8 @@ enum net_verdict tp_input(struct net_conn *net_conn,
 		tp_output(pkt->family, pkt->iface, buf, 1);
 	}
 
+	tp_conn_put(&found);
+
 	return verdict;
 }
 
@@ -4595,6 +5478,9 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = get_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_INFO:
+		ret = get_tcp_info(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
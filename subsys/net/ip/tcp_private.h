@@ -7,6 +7,7 @@
 
 #include "tp.h"
 #include <zephyr/toolchain/gcc.h>
+#include <zephyr/kernel/rcu.h>
 
 #define is(_a, _b) (strcmp((_a), (_b)) == 0)
 
@@ -229,18 +230,47 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
+#define NET_TCP_TIMESTAMP_OPT    8
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_SIZE         2 /* without the blocks */
+#define NET_TCP_SACK_BLOCK_SIZE   8
+#define NET_TCP_TIMESTAMP_SIZE    10
+
+/* At most 4 SACK blocks fit in the 40 bytes of TCP options */
+#define TCP_SACK_MAX_BLOCKS 4
+
+struct tcp_sack_block {
+	uint32_t left;  /* first sequence number of the block */
+	uint32_t right; /* sequence number following the block */
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
+#if defined(CONFIG_NET_TCP_SACK)
+	struct tcp_sack_block sack[TCP_SACK_MAX_BLOCKS];
+	uint8_t sack_num;
+#endif
+#if defined(CONFIG_NET_TCP_TIMESTAMPS)
+	uint32_t tsval;
+	uint32_t tsecr;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
+#if defined(CONFIG_NET_TCP_SACK)
+	bool sack_perm_found : 1;
+#endif
+#if defined(CONFIG_NET_TCP_TIMESTAMPS)
+	bool ts_found : 1;
+#endif
 };
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
@@ -299,6 +329,18 @@ struct tcp { /* TCP connection */
 	};
 	union tcp_endpoint src;
 	union tcp_endpoint dst;
+#if defined(CONFIG_NET_TCP_CONN_HASH)
+	sys_snode_t hash_node;
+	sys_slist_t *bucket; /* list of hash_node, if indexed */
+#endif
+#if defined(CONFIG_NET_CONN_RCU)
+	struct k_rcu_head rcu; /* freed once no lookup sees it any more */
+#endif
+#if defined(CONFIG_NET_TCP_CONN_HASH) && defined(CONFIG_NET_CONN_RCU)
+	struct k_rcu_head rehash; /* put back in the hash table */
+	bool rehash_pending : 1; /* out of the hash table until rehash runs */
+	bool rehash_index : 1; /* to be put back by rehash */
+#endif
 #if defined(CONFIG_NET_TCP_IPV6_ND_REACHABILITY_HINT)
 	int64_t last_nd_hint_time;
 #endif
@@ -320,11 +362,25 @@ struct tcp { /* TCP connection */
 	uint16_t recv_win;
 	uint16_t send_win_max;
 	uint16_t send_win;
-#ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
+#if defined(CONFIG_NET_TCP_RANDOMIZED_RTO) || defined(CONFIG_NET_TCP_TIMESTAMPS)
 	uint16_t rto;
 #endif
+#if defined(CONFIG_NET_TCP_TIMESTAMPS)
+	uint32_t ts_offset; /* added to our clock, so that it is not exposed */
+	uint32_t ts_recent; /* last timestamp of the peer, echoed back */
+	uint32_t srtt;      /* smoothed round-trip time, in 1/8 ms */
+	uint32_t rttvar;    /* round-trip time variation, in 1/4 ms */
+#endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 	struct tcp_collision_avoidance_reno ca;
+#endif
+#if defined(CONFIG_NET_TCP_SACK)
+	/* Sent data the peer has selectively acknowledged, sorted and
+	 * not overlapping.
+	 */
+	struct tcp_sack_block sacked[TCP_SACK_MAX_BLOCKS];
+	uint32_t snd_max; /* highest sequence number sent, plus one */
+	uint8_t sacked_num;
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
@@ -339,6 +395,13 @@ struct tcp { /* TCP connection */
 	bool tcp_nodelay : 1;
 	bool addr_ref_done : 1;
 	bool rst_received : 1;
+#if defined(CONFIG_NET_TCP_SACK)
+	bool sack_ok : 1; /* both ends permit SACK */
+#endif
+#if defined(CONFIG_NET_TCP_TIMESTAMPS)
+	bool ts_ok : 1; /* both ends send timestamps */
+	bool rtt_sampled : 1; /* srtt and rttvar are valid */
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <kernel_internal.h>
+#include <zephyr/kernel.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define NUM_BUCKETS CONFIG_SCHED_THREAD_LATENCY_BUCKETS
+#define SHIFT       CONFIG_SCHED_THREAD_LATENCY_SHIFT
+
+static void shell_latency_summary(const struct k_thread *cthread, void *user_data)
+{
+	const struct shell *sh = (const struct shell *)user_data;
+	struct k_thread *thread = (struct k_thread *)cthread;
+	k_thread_runtime_stats_t stats;
+	const char *tname = k_thread_name_get(thread);
+	uint32_t wakeups = 0U;
+
+	if (k_thread_runtime_stats_get(thread, &stats) != 0) {
+		return;
+	}
+
+	for (int i = 0; i < NUM_BUCKETS; i++) {
+		wakeups += stats.latency_hist[i];
+	}
+
+	shell_print(sh, "%p %-20s wakeups: %-10u preemptions: %-10u peak: %u cycles", cthread,
+		    (tname != NULL) ? tname : "NA", wakeups, stats.preemptions,
+		    stats.peak_latency_cycles);
+}
+
+static int cmd_kernel_thread_latency(const struct shell *sh, size_t argc, char **argv)
+{
+	k_thread_runtime_stats_t stats;
+	k_tid_t thread_id;
+
+	if (argc < 2) {
+		shell_print(sh, "Scheduling latency of all threads:");
+		k_thread_foreach(shell_latency_summary, (void *)sh);
+		return 0;
+	}
+
+	/* thread_id is converted from hex to decimal */
+	thread_id = (k_tid_t)strtoul(argv[1], NULL, 16);
+
+	if (!z_thread_is_valid(thread_id)) {
+		shell_error(sh, "Thread ID %p is not valid", thread_id);
+		return -EINVAL;
+	}
+
+	if (k_thread_runtime_stats_get(thread_id, &stats) != 0) {
+		shell_error(sh, "Unable to get the statistics of thread %p", thread_id);
+		return -EINVAL;
+	}
+
+	shell_print(sh, "Thread %p: %u preemptions, peak latency %u cycles", thread_id,
+		    stats.preemptions, stats.peak_latency_cycles);
+
+	/* Bucket bounds are printed as powers of two, they may not fit in 32 bits */
+	for (int i = 0; i < NUM_BUCKETS; i++) {
+		if (i == 0) {
+			shell_print(sh, "          < 2^%-2d: %u", SHIFT, stats.latency_hist[i]);
+		} else if (i < NUM_BUCKETS - 1) {
+			shell_print(sh, "2^%-2d .. < 2^%-2d: %u", SHIFT + i - 1, SHIFT + i,
+				    stats.latency_hist[i]);
+		} else {
+			shell_print(sh, "2^%-2d ..        : %u", SHIFT + i - 1,
+				    stats.latency_hist[i]);
+		}
+	}
+
+	return 0;
+}
+
+KERNEL_THREAD_CMD_ARG_ADD(latency, NULL,
+			  "kernel thread latency [thread_id]\n"
+			  "Print the scheduling latency histogram of a thread, in cycles,\n"
+			  "or a summary for all threads.",
+			  cmd_kernel_thread_latency, 1, 1);
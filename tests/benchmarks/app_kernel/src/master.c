@@ -132,6 +132,36 @@ static void test_thread_entry(void *p1, void *p2, void *p3)
 	pipe_test();
 }
 
+#if defined(CONFIG_OBJ_CORE_STATS_SEM) && defined(CONFIG_OBJ_CORE_STATS_MUTEX)
+/**
+ * @brief Report how often threads spun on the benchmark objects
+ */
+static void spin_stats_report(void)
+{
+	struct k_sem *sems[] = {&SEM0, &SEM1, &SEM2, &SEM3, &SEM4, &STARTRCV};
+	struct k_adaptive_spin_stats stats;
+	uint32_t spins = 0U;
+	uint32_t acquired = 0U;
+
+	for (size_t i = 0; i < ARRAY_SIZE(sems); i++) {
+		if (k_obj_core_stats_raw(K_OBJ_CORE(sems[i]), &stats,
+					 sizeof(stats)) == 0) {
+			spins += stats.spins;
+			acquired += stats.acquired;
+		}
+	}
+
+	PRINT_F("| semaphore spins: %u, acquired while spinning: %u\n",
+		spins, acquired);
+
+	if (k_obj_core_stats_raw(K_OBJ_CORE(&DEMO_MUTEX), &stats,
+				 sizeof(stats)) == 0) {
+		PRINT_F("| mutex spins: %u, acquired while spinning: %u\n",
+			stats.spins, stats.acquired);
+	}
+}
+#endif /* CONFIG_OBJ_CORE_STATS_SEM && CONFIG_OBJ_CORE_STATS_MUTEX */
+
 /**
  * @brief Perform all benchmarks
  */
@@ -251,6 +281,10 @@ int main(void)
 
 	timing_stop();
 
+#if defined(CONFIG_OBJ_CORE_STATS_SEM) && defined(CONFIG_OBJ_CORE_STATS_MUTEX)
+	spin_stats_report();
+#endif /* CONFIG_OBJ_CORE_STATS_SEM && CONFIG_OBJ_CORE_STATS_MUTEX */
+
 	PRINT_STRING("|         END OF TESTS                     "
 		     "                                   |\n");
 	PRINT_STRING(dashline);
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * This file contains the benchmarking code that measures the average time it
+ * takes to perform context switches between threads using k_yield(), when
+ * these threads use the floating point registers, compared to when they do
+ * the same amount of integer work instead.
+ *
+ * The difference is the cost of switching the floating point context, which
+ * architectures switching it lazily only pay when the threads actually use
+ * the floating point registers in between.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+
+#include "utils.h"
+#include "timing_sc.h"
+
+static volatile double fp_value;
+static volatile uint32_t int_value;
+
+static void do_work(bool use_fp)
+{
+	if (use_fp) {
+		fp_value = fp_value * 1.0001 + 1.0;
+	} else {
+		int_value = int_value * 3U + 1U;
+	}
+}
+
+static void alt_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t  num_iterations = (uint32_t)(uintptr_t)p1;
+	bool      use_fp = (bool)(uintptr_t)p2;
+
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		do_work(use_fp);
+
+		timestamp.sample = timing_timestamp_get();
+
+		k_yield();
+	}
+}
+
+static void start_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint64_t  sum = 0ull;
+	uint32_t  num_iterations = (uint32_t)(uintptr_t)p1;
+	bool      use_fp = (bool)(uintptr_t)p2;
+	timing_t  start;
+	timing_t  finish;
+
+	ARG_UNUSED(p3);
+
+	k_thread_start(&alt_thread);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		do_work(use_fp);
+
+		start = timing_timestamp_get();
+
+		k_yield();
+
+		finish = timestamp.sample;
+
+		sum += timing_cycles_get(&start, &finish);
+	}
+
+	k_thread_join(&alt_thread, K_FOREVER);
+
+	timestamp.cycles = sum;
+}
+
+static void fp_switch_yield_common(uint32_t num_iterations, bool use_fp)
+{
+	uint64_t  sum;
+	char tag[50];
+	char summary[120];
+#ifdef CONFIG_FPU_SHARING_STATS
+	struct k_float_stats start_stats;
+	struct k_float_stats alt_stats;
+	uint32_t saves;
+	uint32_t restores;
+#endif /* CONFIG_FPU_SHARING_STATS */
+
+	/* Both threads are FPU users, whether or not they use the FPU */
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			start_thread_entry,
+			(void *)(uintptr_t)num_iterations,
+			(void *)(uintptr_t)use_fp, NULL,
+			K_PRIO_COOP(6), K_FP_REGS, K_FOREVER);
+
+	k_thread_create(&alt_thread, alt_stack,
+			K_THREAD_STACK_SIZEOF(alt_stack),
+			alt_thread_entry,
+			(void *)(uintptr_t)num_iterations,
+			(void *)(uintptr_t)use_fp, NULL,
+			K_PRIO_COOP(6), K_FP_REGS, K_FOREVER);
+
+	k_thread_start(&start_thread);
+
+	k_thread_join(&start_thread, K_FOREVER);
+
+	sum = timestamp.cycles;
+
+	sum -= timestamp_overhead_adjustment(0, 0);
+
+	snprintf(tag, sizeof(tag), "thread.yield.fpu.%s.ctx",
+		 use_fp ? "fp" : "int");
+	snprintf(summary, sizeof(summary),
+		 "%-40s - Context switch via k_yield, %s work", tag,
+		 use_fp ? "floating point" : "integer");
+
+	PRINT_STATS_AVG(summary, (uint32_t)sum, num_iterations, 0, "");
+
+#ifdef CONFIG_FPU_SHARING_STATS
+	(void)k_float_stats_get(&start_thread, &start_stats);
+	(void)k_float_stats_get(&alt_thread, &alt_stats);
+
+	saves = start_stats.saves + alt_stats.saves;
+	restores = start_stats.restores + alt_stats.restores;
+
+	/* Each iteration switches threads twice */
+	printk("%-40s - %u FP context saves, %u restores for %u switches\n",
+	       tag, saves, restores, 2U * num_iterations);
+#endif /* CONFIG_FPU_SHARING_STATS */
+}
+
+void fp_switch_yield(uint32_t num_iterations)
+{
+	/* Integer work first, so that no FP context is live yet */
+	fp_switch_yield_common(num_iterations, false);
+
+	fp_switch_yield_common(num_iterations, true);
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time for sys_mutex lock and unlock
+ *
+ * This file contains the test that measures the time to lock then unlock a
+ * sys_mutex, compared to a k_mutex. There is no contention on the mutexes
+ * being tested, so user threads lock and unlock the sys_mutex without any
+ * system call when CONFIG_CURRENT_THREAD_USE_TLS is enabled.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/mutex.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+#include "timing_sc.h"
+
+static K_MUTEX_DEFINE(test_k_mutex);
+static BENCH_BMEM SYS_MUTEX_DEFINE(test_sys_mutex);
+
+static void start_lock_unlock(void *p1, void *p2, void *p3)
+{
+	uint32_t  i;
+	uint32_t  num_iterations = (uint32_t)(uintptr_t)p1;
+	timing_t  start;
+	timing_t  finish;
+	uint64_t  k_mutex_cycles;
+	uint64_t  sys_mutex_cycles;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	start = timing_timestamp_get();
+
+	for (i = 0; i < num_iterations; i++) {
+		k_mutex_lock(&test_k_mutex, K_NO_WAIT);
+		k_mutex_unlock(&test_k_mutex);
+	}
+
+	finish = timing_timestamp_get();
+
+	k_mutex_cycles = timing_cycles_get(&start, &finish);
+
+	start = timing_timestamp_get();
+
+	for (i = 0; i < num_iterations; i++) {
+		sys_mutex_lock(&test_sys_mutex, K_NO_WAIT);
+		sys_mutex_unlock(&test_sys_mutex);
+	}
+
+	finish = timing_timestamp_get();
+
+	sys_mutex_cycles = timing_cycles_get(&start, &finish);
+
+	timestamp.cycles = k_mutex_cycles;
+	k_sem_take(&pause_sem, K_FOREVER);
+
+	timestamp.cycles = sys_mutex_cycles;
+}
+
+/**
+ *
+ * @brief Test for the sys_mutex lock/unlock time
+ *
+ * The routine performs multiple lock/unlock pairs on a k_mutex, then on
+ * a sys_mutex to measure the necessary time.
+ *
+ * @return 0 on success
+ */
+int sys_mutex_lock_unlock(uint32_t num_iterations, uint32_t options)
+{
+	char tag[50];
+	char description[120];
+	int  priority;
+	uint64_t  cycles;
+
+	timing_start();
+
+	priority = k_thread_priority_get(k_current_get());
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			start_lock_unlock,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 1, options, K_FOREVER);
+
+	k_thread_access_grant(&start_thread, &test_k_mutex, &pause_sem);
+	k_thread_start(&start_thread);
+
+	cycles = timestamp.cycles;
+	k_sem_give(&pause_sem);
+
+	snprintf(tag, sizeof(tag),
+		 "mutex.lock_unlock.immediate.%s",
+		 (options & K_USER) == K_USER ? "user" : "kernel");
+	snprintf(description, sizeof(description),
+		 "%-40s - Lock and unlock a mutex", tag);
+	PRINT_STATS_AVG(description, (uint32_t)cycles, num_iterations,
+			false, "");
+
+	cycles = timestamp.cycles;
+
+	snprintf(tag, sizeof(tag),
+		 "sys_mutex.lock_unlock.immediate.%s",
+		 (options & K_USER) == K_USER ? "user" : "kernel");
+	snprintf(description, sizeof(description),
+		 "%-40s - Lock and unlock a sys_mutex", tag);
+	PRINT_STATS_AVG(description, (uint32_t)cycles, num_iterations,
+			false, "");
+
+	timing_stop();
+	return 0;
+}
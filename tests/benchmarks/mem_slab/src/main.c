@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures the cost of allocating and freeing memory slab blocks one at a
+ * time and in batches, with one thread up to one thread per CPU sharing
+ * the same memory slab.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define MAX_THREADS CONFIG_MP_MAX_NUM_CPUS
+#define BATCH_SIZE  CONFIG_BENCHMARK_BATCH_SIZE
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+K_MEM_SLAB_DEFINE_STATIC(bench_slab, CONFIG_BENCHMARK_BLOCK_SIZE, MAX_THREADS * BATCH_SIZE, 8);
+
+static K_THREAD_STACK_ARRAY_DEFINE(bench_stack, MAX_THREADS, STACK_SIZE);
+static struct k_thread bench_thread[MAX_THREADS];
+
+static K_SEM_DEFINE(start_sem, 0, MAX_THREADS);
+static K_SEM_DEFINE(done_sem, 0, MAX_THREADS);
+
+static atomic_t errors;
+
+static void single_entry(void *p1, void *p2, void *p3)
+{
+	void *blocks[BATCH_SIZE];
+	unsigned int i;
+	unsigned int j;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sem_take(&start_sem, K_FOREVER);
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		for (j = 0; j < BATCH_SIZE; j++) {
+			if (k_mem_slab_alloc(&bench_slab, &blocks[j], K_FOREVER) != 0) {
+				atomic_inc(&errors);
+				break;
+			}
+		}
+
+		while (j-- > 0) {
+			k_mem_slab_free(&bench_slab, blocks[j]);
+		}
+	}
+
+	k_sem_give(&done_sem);
+}
+
+static void bulk_entry(void *p1, void *p2, void *p3)
+{
+	void *blocks[BATCH_SIZE];
+	unsigned int i;
+	int n;
+	int rc;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sem_take(&start_sem, K_FOREVER);
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		/* a bulk allocation may return fewer blocks than requested */
+		for (n = 0; n < BATCH_SIZE; n += rc) {
+			rc = k_mem_slab_alloc_bulk(&bench_slab, &blocks[n], BATCH_SIZE - n,
+						   K_FOREVER);
+			if (rc < 0) {
+				atomic_inc(&errors);
+				break;
+			}
+		}
+
+		k_mem_slab_free_bulk(&bench_slab, blocks, n);
+	}
+
+	k_sem_give(&done_sem);
+}
+
+static uint64_t run_threads(k_thread_entry_t entry, unsigned int num_threads)
+{
+	timing_t start;
+	timing_t finish;
+	unsigned int i;
+
+	for (i = 0; i < num_threads; i++) {
+		k_thread_create(&bench_thread[i], bench_stack[i], STACK_SIZE,
+				entry, NULL, NULL, NULL,
+				K_PRIO_PREEMPT(5), 0, K_NO_WAIT);
+	}
+
+	/* let all threads reach their start semaphore */
+	k_sleep(K_MSEC(10));
+
+	start = timing_counter_get();
+
+	for (i = 0; i < num_threads; i++) {
+		k_sem_give(&start_sem);
+	}
+
+	for (i = 0; i < num_threads; i++) {
+		k_sem_take(&done_sem, K_FOREVER);
+	}
+
+	finish = timing_counter_get();
+
+	for (i = 0; i < num_threads; i++) {
+		k_thread_join(&bench_thread[i], K_FOREVER);
+	}
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles)
+{
+#ifdef CONFIG_BENCHMARK_RECORDING
+	int tag_len = strlen(tag);
+	int descr_len = strlen(str);
+	int stag_len = strlen(".avg");
+	int sdescr_len = strlen(", avg.");
+
+	stag_len = (tag_len + stag_len < 40) ? 40 - tag_len : stag_len;
+	sdescr_len = (descr_len + sdescr_len < 50) ? 50 - descr_len : sdescr_len;
+
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".avg", str,
+	       sdescr_len, ", avg.", cycles, (uint32_t)timing_cycles_to_ns(cycles));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-50s : %7llu cycles (%7u nsec)\n", str, cycles,
+	       (uint32_t)timing_cycles_to_ns(cycles));
+#endif
+}
+
+int main(void)
+{
+	unsigned int num_threads;
+	uint64_t num_blocks;
+	uint64_t cycles;
+	char tag[40];
+	char str[50];
+
+	timing_init();
+
+	printk("Memory slab allocation throughput (%s)\n",
+	       IS_ENABLED(CONFIG_MEM_SLAB_CPU_CACHE) ? "per-CPU caches" : "no caches");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+	printk("%u CPUs, batches of %u blocks of %u bytes\n", arch_num_cpus(), BATCH_SIZE,
+	       CONFIG_BENCHMARK_BLOCK_SIZE);
+
+	timing_start();
+
+	for (num_threads = 1; num_threads <= arch_num_cpus(); num_threads++) {
+		/* every thread allocates and frees every block once per iteration */
+		num_blocks = (uint64_t)num_threads * CONFIG_BENCHMARK_NUM_ITERATIONS * BATCH_SIZE;
+
+		cycles = run_threads(single_entry, num_threads);
+		snprintk(tag, sizeof(tag), "mem_slab.single.%uthreads", num_threads);
+		snprintk(str, sizeof(str), "Alloc/free one block, %u threads", num_threads);
+		report(tag, str, cycles / num_blocks);
+
+		cycles = run_threads(bulk_entry, num_threads);
+		snprintk(tag, sizeof(tag), "mem_slab.bulk.%uthreads", num_threads);
+		snprintk(str, sizeof(str), "Alloc/free one block in bulk, %u threads",
+			 num_threads);
+		report(tag, str, cycles / num_blocks);
+	}
+
+	timing_stop();
+
+	if (k_mem_slab_num_used_get(&bench_slab) != 0) {
+		printk("%u blocks were not freed\n", k_mem_slab_num_used_get(&bench_slab));
+		atomic_inc(&errors);
+	}
+
+	if (atomic_get(&errors) != 0) {
+		printk("%ld allocations failed\n", (long)atomic_get(&errors));
+	}
+
+	TC_END_REPORT(atomic_get(&errors) == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures the throughput of a message queue shared by several producer
+ * and consumer threads. On SMP systems the threads run concurrently on
+ * all CPUs.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define NUM_PRODUCERS CONFIG_BENCHMARK_NUM_PRODUCERS
+#define NUM_CONSUMERS CONFIG_BENCHMARK_NUM_CONSUMERS
+#define NUM_MESSAGES  CONFIG_BENCHMARK_NUM_MESSAGES
+#define TOTAL_MESSAGES (NUM_PRODUCERS * NUM_MESSAGES)
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct bench_msg {
+	uint32_t producer;
+	uint32_t seq;
+};
+
+K_MSGQ_LOCKFREE_DEFINE(bench_msgq, sizeof(struct bench_msg), CONFIG_BENCHMARK_QUEUE_DEPTH, 4);
+
+static K_THREAD_STACK_ARRAY_DEFINE(producer_stack, NUM_PRODUCERS, STACK_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(consumer_stack, NUM_CONSUMERS, STACK_SIZE);
+
+static struct k_thread producer_thread[NUM_PRODUCERS];
+static struct k_thread consumer_thread[NUM_CONSUMERS];
+
+static K_SEM_DEFINE(start_sem, 0, NUM_PRODUCERS + NUM_CONSUMERS);
+static K_SEM_DEFINE(done_sem, 0, NUM_PRODUCERS + NUM_CONSUMERS);
+
+static atomic_t errors;
+
+static void producer_entry(void *p1, void *p2, void *p3)
+{
+	struct bench_msg msg = { .producer = POINTER_TO_UINT(p1) };
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sem_take(&start_sem, K_FOREVER);
+
+	for (msg.seq = 0; msg.seq < NUM_MESSAGES; msg.seq++) {
+		if (k_msgq_put(&bench_msgq, &msg, K_FOREVER) != 0) {
+			atomic_inc(&errors);
+		}
+	}
+
+	k_sem_give(&done_sem);
+}
+
+static void consumer_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t num_msgs = POINTER_TO_UINT(p1);
+	uint32_t next_seq[NUM_PRODUCERS] = { 0 };
+	struct bench_msg msg;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sem_take(&start_sem, K_FOREVER);
+
+	while (num_msgs-- > 0) {
+		if ((k_msgq_get(&bench_msgq, &msg, K_FOREVER) != 0) ||
+		    (msg.producer >= NUM_PRODUCERS)) {
+			atomic_inc(&errors);
+			continue;
+		}
+
+		/* each consumer must see the messages of a producer in order */
+		if (msg.seq < next_seq[msg.producer]) {
+			atomic_inc(&errors);
+		}
+		next_seq[msg.producer] = msg.seq + 1;
+	}
+
+	k_sem_give(&done_sem);
+}
+
+static uint64_t run_transfer(void)
+{
+	timing_t start;
+	timing_t finish;
+	uint32_t num_msgs;
+	unsigned int i;
+
+	for (i = 0; i < NUM_PRODUCERS; i++) {
+		k_thread_create(&producer_thread[i], producer_stack[i], STACK_SIZE,
+				producer_entry, UINT_TO_POINTER(i), NULL, NULL,
+				K_PRIO_PREEMPT(5), 0, K_NO_WAIT);
+	}
+
+	for (i = 0; i < NUM_CONSUMERS; i++) {
+		/* the first consumer also takes the remainder of the messages */
+		num_msgs = TOTAL_MESSAGES / NUM_CONSUMERS;
+		if (i == 0) {
+			num_msgs += TOTAL_MESSAGES % NUM_CONSUMERS;
+		}
+
+		k_thread_create(&consumer_thread[i], consumer_stack[i], STACK_SIZE,
+				consumer_entry, UINT_TO_POINTER(num_msgs), NULL, NULL,
+				K_PRIO_PREEMPT(5), 0, K_NO_WAIT);
+	}
+
+	/* let all threads reach their start semaphore */
+	k_sleep(K_MSEC(10));
+
+	start = timing_counter_get();
+
+	for (i = 0; i < NUM_PRODUCERS + NUM_CONSUMERS; i++) {
+		k_sem_give(&start_sem);
+	}
+
+	for (i = 0; i < NUM_PRODUCERS + NUM_CONSUMERS; i++) {
+		k_sem_take(&done_sem, K_FOREVER);
+	}
+
+	finish = timing_counter_get();
+
+	for (i = 0; i < NUM_PRODUCERS; i++) {
+		k_thread_join(&producer_thread[i], K_FOREVER);
+	}
+
+	for (i = 0; i < NUM_CONSUMERS; i++) {
+		k_thread_join(&consumer_thread[i], K_FOREVER);
+	}
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles)
+{
+#ifdef CONFIG_BENCHMARK_RECORDING
+	int tag_len = strlen(tag);
+	int descr_len = strlen(str);
+	int stag_len = strlen(".avg");
+	int sdescr_len = strlen(", avg.");
+
+	stag_len = (tag_len + stag_len < 40) ? 40 - tag_len : stag_len;
+	sdescr_len = (descr_len + sdescr_len < 50) ? 50 - descr_len : sdescr_len;
+
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".avg", str,
+	       sdescr_len, ", avg.", cycles, (uint32_t)timing_cycles_to_ns(cycles));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-50s : %7llu cycles (%7u nsec)\n", str, cycles,
+	       (uint32_t)timing_cycles_to_ns(cycles));
+#endif
+}
+
+int main(void)
+{
+	uint64_t total_cycles = 0;
+	uint64_t total_ns;
+	unsigned int i;
+
+	timing_init();
+
+	printk("Message queue MPMC throughput (%s)\n",
+	       IS_ENABLED(CONFIG_MSGQ_LOCKFREE) ? "lock-free ring" : "locked");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+	printk("%u CPUs, %u producers, %u consumers, queue depth %u, %u messages\n",
+	       arch_num_cpus(), NUM_PRODUCERS, NUM_CONSUMERS,
+	       CONFIG_BENCHMARK_QUEUE_DEPTH, TOTAL_MESSAGES);
+
+	timing_start();
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		total_cycles += run_transfer();
+	}
+
+	timing_stop();
+
+	report("msgq.mpmc.transfer", "Transfer all messages", total_cycles /
+	       CONFIG_BENCHMARK_NUM_ITERATIONS);
+	report("msgq.mpmc.message", "Transfer one message", total_cycles /
+	       ((uint64_t)CONFIG_BENCHMARK_NUM_ITERATIONS * TOTAL_MESSAGES));
+
+	total_ns = timing_cycles_to_ns(total_cycles);
+	if (total_ns != 0) {
+		printk("Throughput: %llu messages/s\n",
+		       ((uint64_t)CONFIG_BENCHMARK_NUM_ITERATIONS * TOTAL_MESSAGES *
+			NSEC_PER_SEC) / total_ns);
+	}
+
+	if (atomic_get(&errors) != 0) {
+		printk("%ld messages were lost or reordered\n", (long)atomic_get(&errors));
+	}
+
+	TC_END_REPORT(atomic_get(&errors) == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Compares the choice of the memory regions of a multi heap by attribute
+ * only, and by CPU affinity, on a model of a SoC with a small CPU local
+ * memory and a large shared memory of different latencies.
+ *
+ * Both choices allocate and free blocks of random sizes in the same
+ * sequence.  The time to access the blocks is modelled from the latency of
+ * the region each block is allocated from, so that the results do not
+ * depend on the memories of the platform running the benchmark, which
+ * may well be native_sim.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/multi_heap.h>
+#include <zephyr/tc_util.h>
+#include <string.h>
+
+#define LOCAL_SIZE  CONFIG_BENCHMARK_LOCAL_SIZE
+#define SHARED_SIZE CONFIG_BENCHMARK_SHARED_SIZE
+#define MAX_BLOCKS  CONFIG_BENCHMARK_MAX_BLOCKS
+#define LINE_SIZE   32
+
+struct region {
+	uint32_t latency_ns;
+};
+
+static const struct region local_region = {
+	.latency_ns = CONFIG_BENCHMARK_LOCAL_LATENCY_NS,
+};
+
+static const struct region shared_region = {
+	.latency_ns = CONFIG_BENCHMARK_SHARED_LATENCY_NS,
+};
+
+static uint8_t __aligned(8) local_mem[LOCAL_SIZE];
+static uint8_t __aligned(8) shared_mem[SHARED_SIZE];
+static struct sys_heap local_heap;
+static struct sys_heap shared_heap;
+static struct sys_multi_heap mheap;
+
+static void *blocks[MAX_BLOCKS];
+static unsigned int num_blocks;
+
+struct run_stats {
+	uint64_t alloc_cycles;
+	uint64_t access_ns;
+	uint32_t allocs;
+	uint32_t failed_allocs;
+	uint32_t local_allocs;
+};
+
+static uint64_t rand_state;
+
+/* Same LCRNG as the heap stress test, for repeatable runs */
+static uint32_t rand32(void)
+{
+	rand_state = rand_state * 2862933555777941757ULL + 3037000493ULL;
+
+	return (uint32_t)(rand_state >> 32);
+}
+
+/* Sizes from 1 byte to 512 bytes, smaller ones being more frequent */
+static size_t rand_size(void)
+{
+	unsigned int scale = 3 + (rand32() % 7);
+
+	return 1 + (rand32() & BIT_MASK(scale));
+}
+
+/* Tries the regions in the order they were registered, as a choice
+ * function only aware of their attributes would
+ */
+static void *attr_choice(struct sys_multi_heap *mh, void *cfg, size_t align, size_t size)
+{
+	void *block;
+
+	ARG_UNUSED(mh);
+	ARG_UNUSED(cfg);
+
+	block = sys_heap_aligned_alloc(&shared_heap, align, size);
+	if (block == NULL) {
+		block = sys_heap_aligned_alloc(&local_heap, align, size);
+	}
+
+	return block;
+}
+
+static void setup(sys_multi_heap_fn_t choice)
+{
+	sys_heap_init(&shared_heap, shared_mem, SHARED_SIZE);
+	sys_heap_init(&local_heap, local_mem, LOCAL_SIZE);
+
+	sys_multi_heap_init(&mheap, choice);
+	sys_multi_heap_add_heap(&mheap, &shared_heap, (void *)&shared_region);
+	sys_multi_heap_add_heap(&mheap, &local_heap, (void *)&local_region);
+
+	/* The model has a single CPU with local memory */
+	(void)sys_multi_heap_set_affinity(&mheap, &local_heap, BIT(0));
+	(void)sys_multi_heap_set_preferred(&mheap, 0, &local_heap);
+
+	rand_state = 123456789;
+}
+
+static void do_alloc(struct run_stats *stats)
+{
+	const struct sys_multi_heap_rec *rec;
+	const struct region *region;
+	size_t size = rand_size();
+	uint32_t start;
+	uint32_t finish;
+	void *mem;
+
+	start = k_cycle_get_32();
+	mem = sys_multi_heap_alloc(&mheap, NULL, size);
+	finish = k_cycle_get_32();
+
+	stats->alloc_cycles += finish - start;
+	stats->allocs++;
+
+	if (mem == NULL) {
+		stats->failed_allocs++;
+		return;
+	}
+
+	rec = sys_multi_heap_get_heap(&mheap, mem);
+	region = rec->user_data;
+	if (region == &local_region) {
+		stats->local_allocs++;
+	}
+	stats->access_ns += (uint64_t)DIV_ROUND_UP(size, LINE_SIZE) *
+			    CONFIG_BENCHMARK_ACCESSES * region->latency_ns;
+
+	blocks[num_blocks++] = mem;
+}
+
+static void do_free(void)
+{
+	unsigned int i = rand32() % num_blocks;
+
+	sys_multi_heap_free(&mheap, blocks[i]);
+	blocks[i] = blocks[--num_blocks];
+}
+
+static void run(struct run_stats *stats)
+{
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_OPERATIONS; i++) {
+		if ((num_blocks == 0) ||
+		    ((num_blocks < MAX_BLOCKS) && (rand32() & 1))) {
+			do_alloc(stats);
+		} else {
+			do_free();
+		}
+	}
+
+	while (num_blocks > 0) {
+		do_free();
+	}
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles, uint64_t ns)
+{
+#ifdef CONFIG_BENCHMARK_RECORDING
+	int tag_len = strlen(tag);
+	int descr_len = strlen(str);
+	int stag_len = strlen(".avg");
+	int sdescr_len = strlen(", avg.");
+
+	stag_len = (tag_len + stag_len < 40) ? 40 - tag_len : stag_len;
+	sdescr_len = (descr_len + sdescr_len < 50) ? 50 - descr_len : sdescr_len;
+
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".avg", str,
+	       sdescr_len, ", avg.", cycles, (uint32_t)ns);
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-50s : %7llu cycles (%7u nsec)\n", str, cycles, (uint32_t)ns);
+#endif
+}
+
+static void report_run(const char *name, struct run_stats *stats)
+{
+	struct sys_multi_heap_region_stats local_stats;
+	struct sys_multi_heap_region_stats shared_stats;
+	uint32_t allocs = stats->allocs - stats->failed_allocs;
+	uint64_t cycles = stats->alloc_cycles / stats->allocs;
+	char tag[50];
+	char str[64];
+
+	snprintk(tag, sizeof(tag), "multi_heap.%s.alloc", name);
+	snprintk(str, sizeof(str), "Allocate a block, by %s", name);
+	report(tag, str, cycles, k_cyc_to_ns_floor64(cycles));
+
+	snprintk(tag, sizeof(tag), "multi_heap.%s.access", name);
+	snprintk(str, sizeof(str), "Access a block (modelled), by %s", name);
+	report(tag, str, 0, stats->access_ns / allocs);
+
+	/* Region stats are only kept by sys_multi_heap_affinity_alloc() */
+	(void)sys_multi_heap_region_stats_get(&mheap, &local_heap, &local_stats);
+	(void)sys_multi_heap_region_stats_get(&mheap, &shared_heap, &shared_stats);
+
+	printk("By %s: %u/%u allocations failed, %u%% local, %u fallbacks\n",
+	       name, stats->failed_allocs, stats->allocs,
+	       (100U * stats->local_allocs) / allocs,
+	       local_stats.fallbacks + shared_stats.fallbacks);
+}
+
+int main(void)
+{
+	struct run_stats attr_stats = { 0 };
+	struct run_stats affinity_stats = { 0 };
+
+	printk("Multi heap region choice, by attribute and by CPU affinity\n");
+	printk("%u byte local region (%u ns), %u byte shared region (%u ns), "
+	       "%u operations\n", LOCAL_SIZE, CONFIG_BENCHMARK_LOCAL_LATENCY_NS,
+	       SHARED_SIZE, CONFIG_BENCHMARK_SHARED_LATENCY_NS,
+	       CONFIG_BENCHMARK_NUM_OPERATIONS);
+
+	setup(attr_choice);
+	run(&attr_stats);
+	report_run("attribute", &attr_stats);
+
+	setup(sys_multi_heap_affinity_choice);
+	run(&affinity_stats);
+	report_run("affinity", &affinity_stats);
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures the time to deliver a UDP datagram to a socket over the loopback
+ * interface, as the number of bound sockets grows.
+ *
+ * Every incoming datagram has the connection handler of its destination
+ * chosen among the registered ones, which is what grows with the number of
+ * sockets. The datagrams go to the first socket bound, so that the choice
+ * is made among as many handlers as possible.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/tc_util.h>
+#include <string.h>
+
+#define MAX_SOCKETS CONFIG_BENCHMARK_MAX_SOCKETS
+#define FIRST_PORT  5000
+
+static int sender;
+static int sockets[MAX_SOCKETS];
+static unsigned int num_sockets;
+
+static struct sockaddr_in loopback_addr(uint16_t port)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(port),
+		.sin_addr = INADDR_LOOPBACK_INIT,
+	};
+
+	return addr;
+}
+
+static int open_socket(void)
+{
+	struct sockaddr_in addr = loopback_addr(FIRST_PORT + num_sockets);
+	int sock;
+
+	sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (sock < 0) {
+		return -errno;
+	}
+
+	if (zsock_bind(sock, (const struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		(void)zsock_close(sock);
+		return -errno;
+	}
+
+	sockets[num_sockets++] = sock;
+
+	return 0;
+}
+
+static void close_sockets(void)
+{
+	while (num_sockets > 0) {
+		(void)zsock_close(sockets[--num_sockets]);
+	}
+
+	(void)zsock_close(sender);
+}
+
+static int deliver(uint32_t *cycles)
+{
+	struct sockaddr_in addr = loopback_addr(FIRST_PORT);
+	uint8_t byte = 0x55;
+	uint32_t start;
+	int ret = 0;
+
+	start = k_cycle_get_32();
+
+	if (zsock_sendto(sender, &byte, sizeof(byte), 0,
+			 (const struct sockaddr *)&addr, sizeof(addr)) != sizeof(byte) ||
+	    zsock_recv(sockets[0], &byte, sizeof(byte), 0) != sizeof(byte)) {
+		ret = -EIO;
+	}
+
+	*cycles = k_cycle_get_32() - start;
+
+	return ret;
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles, uint64_t ns)
+{
+#ifdef CONFIG_BENCHMARK_RECORDING
+	int tag_len = strlen(tag);
+	int descr_len = strlen(str);
+	int stag_len = strlen(".avg");
+	int sdescr_len = strlen(", avg.");
+
+	stag_len = (tag_len + stag_len < 40) ? 40 - tag_len : stag_len;
+	sdescr_len = (descr_len + sdescr_len < 50) ? 50 - descr_len : sdescr_len;
+
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".avg", str,
+	       sdescr_len, ", avg.", cycles, (uint32_t)ns);
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-50s : %7llu cycles (%7u nsec)\n", str, cycles, (uint32_t)ns);
+#endif
+}
+
+static int measure(void)
+{
+	uint64_t sum = 0;
+	uint64_t cycles;
+	uint32_t dgram_cycles;
+	char tag[50];
+	char str[64];
+	int ret;
+
+	/* Warm up */
+	ret = deliver(&dgram_cycles);
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		ret = deliver(&dgram_cycles);
+		if (ret < 0) {
+			return ret;
+		}
+
+		sum += dgram_cycles;
+	}
+
+	cycles = sum / CONFIG_BENCHMARK_NUM_ITERATIONS;
+
+	snprintk(tag, sizeof(tag), "net.udp.deliver.%u", num_sockets);
+	snprintk(str, sizeof(str), "Deliver a datagram with %u sockets", num_sockets);
+	report(tag, str, cycles, k_cyc_to_ns_floor64(cycles));
+
+	return 0;
+}
+
+int main(void)
+{
+	unsigned int next = 1;
+	int ret = 0;
+
+	printk("UDP datagram delivery, %s lookup, up to %u sockets\n",
+	       IS_ENABLED(CONFIG_NET_CONN_HASH) ? "hash table" : "list",
+	       MAX_SOCKETS);
+
+	/* Bound to an ephemeral port by its first datagram */
+	sender = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (sender < 0) {
+		ret = -errno;
+	}
+
+	while (ret == 0 && num_sockets < MAX_SOCKETS) {
+		ret = open_socket();
+		if (ret < 0) {
+			printk("Cannot open socket %u (%d)\n", num_sockets + 1, ret);
+			break;
+		}
+
+		if (num_sockets == next || num_sockets == MAX_SOCKETS) {
+			ret = measure();
+			next *= 2;
+		}
+	}
+
+	close_sockets();
+
+	TC_END_REPORT(ret == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
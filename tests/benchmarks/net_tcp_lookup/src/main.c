@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures the time for a one byte round trip over a TCP connection on the
+ * loopback interface, as the number of open connections grows.
+ *
+ * The connection used for the round trips is always the last one opened,
+ * which is the last one a walk of all the connections gets to. Each round
+ * trip has the TCP stack look up the connection of two segments, one for
+ * each end of the connection.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/tc_util.h>
+#include <string.h>
+
+#define MAX_CONNS   CONFIG_BENCHMARK_MAX_CONNS
+#define SERVER_PORT 4242
+
+static int listener;
+static int clients[MAX_CONNS];
+static int servers[MAX_CONNS];
+static unsigned int num_conns;
+
+static const struct sockaddr_in server_addr = {
+	.sin_family = AF_INET,
+	.sin_port = htons(SERVER_PORT),
+	.sin_addr = INADDR_LOOPBACK_INIT,
+};
+
+static int set_nodelay(int sock)
+{
+	int one = 1;
+
+	return zsock_setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+}
+
+static int setup(void)
+{
+	listener = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (listener < 0) {
+		return -errno;
+	}
+
+	if (zsock_bind(listener, (const struct sockaddr *)&server_addr,
+		       sizeof(server_addr)) < 0) {
+		return -errno;
+	}
+
+	if (zsock_listen(listener, 1) < 0) {
+		return -errno;
+	}
+
+	return 0;
+}
+
+static int open_conn(void)
+{
+	int client;
+	int server;
+
+	client = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (client < 0) {
+		return -errno;
+	}
+
+	if (zsock_connect(client, (const struct sockaddr *)&server_addr,
+			  sizeof(server_addr)) < 0) {
+		return -errno;
+	}
+
+	server = zsock_accept(listener, NULL, NULL);
+	if (server < 0) {
+		return -errno;
+	}
+
+	if (set_nodelay(client) < 0 || set_nodelay(server) < 0) {
+		return -errno;
+	}
+
+	clients[num_conns] = client;
+	servers[num_conns] = server;
+	num_conns++;
+
+	return 0;
+}
+
+static void close_conns(void)
+{
+	while (num_conns > 0) {
+		num_conns--;
+		(void)zsock_close(clients[num_conns]);
+		(void)zsock_close(servers[num_conns]);
+	}
+
+	(void)zsock_close(listener);
+}
+
+static int pass_byte(int from, int to)
+{
+	uint8_t byte = 0x55;
+
+	if (zsock_send(from, &byte, sizeof(byte), 0) != sizeof(byte)) {
+		return -EIO;
+	}
+
+	if (zsock_recv(to, &byte, sizeof(byte), 0) != sizeof(byte)) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int round_trip(uint32_t *cycles)
+{
+	int client = clients[num_conns - 1];
+	int server = servers[num_conns - 1];
+	uint32_t start;
+	int ret;
+
+	start = k_cycle_get_32();
+
+	ret = pass_byte(client, server);
+	if (ret == 0) {
+		ret = pass_byte(server, client);
+	}
+
+	*cycles = k_cycle_get_32() - start;
+
+	return ret;
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles, uint64_t ns)
+{
+#ifdef CONFIG_BENCHMARK_RECORDING
+	int tag_len = strlen(tag);
+	int descr_len = strlen(str);
+	int stag_len = strlen(".avg");
+	int sdescr_len = strlen(", avg.");
+
+	stag_len = (tag_len + stag_len < 40) ? 40 - tag_len : stag_len;
+	sdescr_len = (descr_len + sdescr_len < 50) ? 50 - descr_len : sdescr_len;
+
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".avg", str,
+	       sdescr_len, ", avg.", cycles, (uint32_t)ns);
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-50s : %7llu cycles (%7u nsec)\n", str, cycles, (uint32_t)ns);
+#endif
+}
+
+static int measure(void)
+{
+	uint64_t sum = 0;
+	uint64_t cycles;
+	uint32_t rt_cycles;
+	char tag[50];
+	char str[64];
+	int ret;
+
+	/* Warm up, also letting the last acknowledgments of the setup go */
+	ret = round_trip(&rt_cycles);
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		ret = round_trip(&rt_cycles);
+		if (ret < 0) {
+			return ret;
+		}
+
+		sum += rt_cycles;
+	}
+
+	cycles = sum / CONFIG_BENCHMARK_NUM_ITERATIONS;
+
+	snprintk(tag, sizeof(tag), "net.tcp.round_trip.%u", num_conns);
+	snprintk(str, sizeof(str), "Round trip with %u connections", num_conns);
+	report(tag, str, cycles, k_cyc_to_ns_floor64(cycles));
+
+	return 0;
+}
+
+int main(void)
+{
+	unsigned int next = 1;
+	int ret;
+
+	printk("TCP segment dispatch, %s lookup, up to %u connections\n",
+	       IS_ENABLED(CONFIG_NET_TCP_CONN_HASH) ? "hash table" : "list",
+	       MAX_CONNS);
+
+	ret = setup();
+
+	while (ret == 0 && num_conns < MAX_CONNS) {
+		ret = open_conn();
+		if (ret < 0) {
+			printk("Cannot open connection %u (%d)\n", num_conns + 1, ret);
+			break;
+		}
+
+		if (num_conns == next || num_conns == MAX_CONNS) {
+			ret = measure();
+			next *= 2;
+		}
+	}
+
+	close_conns();
+
+	TC_END_REPORT(ret == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures the cost of waking a thread polling many semaphores, of which
+ * one is available at a time, with k_poll() and with a persistent poll set.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define MAX_EVENTS 256
+#define MAX_READY  8
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_DEFINE(poller_stack, STACK_SIZE);
+static struct k_thread poller_thread;
+
+static struct k_sem sems[MAX_EVENTS];
+static struct k_poll_event events[MAX_EVENTS];
+static struct k_poll_set set;
+
+static volatile bool stop;
+static atomic_t errors;
+
+static void poll_entry(void *p1, void *p2, void *p3)
+{
+	int num_events = POINTER_TO_INT(p1);
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!stop) {
+		if (k_poll(events, num_events, K_FOREVER) != 0) {
+			atomic_inc(&errors);
+		}
+
+		for (int i = 0; i < num_events; i++) {
+			if (events[i].state == K_POLL_STATE_SEM_AVAILABLE) {
+				(void)k_sem_take(&sems[i], K_NO_WAIT);
+			}
+			events[i].state = K_POLL_STATE_NOT_READY;
+		}
+	}
+}
+
+static void set_entry(void *p1, void *p2, void *p3)
+{
+	struct k_poll_event *ready[MAX_READY];
+	int num_ready;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!stop) {
+		num_ready = k_poll_set_wait(&set, ready, MAX_READY, K_FOREVER);
+		if (num_ready < 0) {
+			atomic_inc(&errors);
+			continue;
+		}
+
+		for (int i = 0; i < num_ready; i++) {
+			(void)k_sem_take(ready[i]->sem, K_NO_WAIT);
+		}
+	}
+}
+
+static uint64_t run_poller(k_thread_entry_t entry, int num_events)
+{
+	timing_t start;
+	timing_t finish;
+
+	stop = false;
+
+	/* The poller preempts this thread as soon as a semaphore is given */
+	k_thread_create(&poller_thread, poller_stack, STACK_SIZE, entry,
+			INT_TO_POINTER(num_events), NULL, NULL,
+			k_thread_priority_get(k_current_get()) - 1, 0, K_NO_WAIT);
+
+	start = timing_counter_get();
+
+	for (int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		k_sem_give(&sems[i % num_events]);
+	}
+
+	finish = timing_counter_get();
+
+	stop = true;
+	k_sem_give(&sems[0]);
+	k_thread_join(&poller_thread, K_FOREVER);
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles)
+{
+#ifdef CONFIG_BENCHMARK_RECORDING
+	int tag_len = strlen(tag);
+	int descr_len = strlen(str);
+	int stag_len = strlen(".avg");
+	int sdescr_len = strlen(", avg.");
+
+	stag_len = (tag_len + stag_len < 40) ? 40 - tag_len : stag_len;
+	sdescr_len = (descr_len + sdescr_len < 50) ? 50 - descr_len : sdescr_len;
+
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".avg", str,
+	       sdescr_len, ", avg.", cycles, (uint32_t)timing_cycles_to_ns(cycles));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-50s : %7llu cycles (%7u nsec)\n", str, cycles,
+	       (uint32_t)timing_cycles_to_ns(cycles));
+#endif
+}
+
+static void run_size(int num_events)
+{
+	uint64_t cycles;
+	char tag[40];
+	char str[50];
+
+	for (int i = 0; i < num_events; i++) {
+		k_sem_init(&sems[i], 0, 1);
+		k_poll_event_init(&events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &sems[i]);
+	}
+
+	cycles = run_poller(poll_entry, num_events);
+	snprintk(tag, sizeof(tag), "poll_set.k_poll.%d", num_events);
+	snprintk(str, sizeof(str), "Wake k_poll() on %d semaphores", num_events);
+	report(tag, str, cycles / CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	k_poll_set_init(&set);
+	for (int i = 0; i < num_events; i++) {
+		k_sem_reset(&sems[i]);
+		events[i].state = K_POLL_STATE_NOT_READY;
+		if (k_poll_set_add(&set, &events[i]) != 0) {
+			atomic_inc(&errors);
+		}
+	}
+
+	cycles = run_poller(set_entry, num_events);
+	snprintk(tag, sizeof(tag), "poll_set.set.%d", num_events);
+	snprintk(str, sizeof(str), "Wake k_poll_set_wait() on %d semaphores", num_events);
+	report(tag, str, cycles / CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	for (int i = 0; i < num_events; i++) {
+		(void)k_poll_set_remove(&set, &events[i]);
+	}
+}
+
+int main(void)
+{
+	static const int sizes[] = { 8, 64, MAX_EVENTS };
+
+	timing_init();
+
+	printk("Poll set scalability\n");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+		run_size(sizes[i]);
+	}
+
+	timing_stop();
+
+	if (atomic_get(&errors) != 0) {
+		printk("%ld polls failed\n", (long)atomic_get(&errors));
+	}
+
+	TC_END_REPORT(atomic_get(&errors) == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
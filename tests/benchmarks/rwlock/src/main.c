@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures how reading shared data under a reader-writer lock scales with
+ * the number of threads doing it, compared to doing it under a mutex.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define MAX_THREADS CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* Below the main thread, which starts them all before they run */
+#define THREAD_PRIORITY K_PRIO_PREEMPT(10)
+
+enum lock_op {
+	OP_READ_LOCK,
+	OP_MUTEX,
+	OP_WRITE_LOCK,
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_THREADS, STACK_SIZE);
+static struct k_thread threads[MAX_THREADS];
+static uint64_t thread_cycles[MAX_THREADS];
+
+static K_SEM_DEFINE(start_sem, 0, MAX_THREADS);
+static struct k_rwlock rwlock;
+static struct k_mutex mutex;
+
+static volatile uint32_t shared_data;
+
+static void lock_entry(void *p1, void *p2, void *p3)
+{
+	int id = POINTER_TO_INT(p1);
+	enum lock_op op = POINTER_TO_INT(p2);
+	uint32_t sum = 0U;
+	timing_t start;
+	timing_t finish;
+
+	ARG_UNUSED(p3);
+
+	k_sem_take(&start_sem, K_FOREVER);
+
+	start = timing_counter_get();
+
+	for (int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		switch (op) {
+		case OP_READ_LOCK:
+			k_rwlock_read_lock(&rwlock, K_FOREVER);
+			sum += shared_data;
+			k_rwlock_read_unlock(&rwlock);
+			break;
+		case OP_MUTEX:
+			k_mutex_lock(&mutex, K_FOREVER);
+			sum += shared_data;
+			k_mutex_unlock(&mutex);
+			break;
+		case OP_WRITE_LOCK:
+			k_rwlock_write_lock(&rwlock, K_FOREVER);
+			shared_data++;
+			k_rwlock_write_unlock(&rwlock);
+			break;
+		}
+	}
+
+	finish = timing_counter_get();
+
+	thread_cycles[id] = timing_cycles_get(&start, &finish);
+
+	ARG_UNUSED(sum);
+}
+
+/* Returns the average cycles for one thread to lock and unlock once */
+static uint64_t run_threads(enum lock_op op, int num_threads)
+{
+	uint64_t cycles = 0U;
+
+	for (int i = 0; i < num_threads; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, lock_entry,
+				INT_TO_POINTER(i), INT_TO_POINTER(op), NULL,
+				THREAD_PRIORITY, 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < num_threads; i++) {
+		k_sem_give(&start_sem);
+	}
+
+	for (int i = 0; i < num_threads; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+		cycles += thread_cycles[i];
+	}
+
+	return cycles / num_threads / CONFIG_BENCHMARK_NUM_ITERATIONS;
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles)
+{
+#ifdef CONFIG_BENCHMARK_RECORDING
+	int tag_len = strlen(tag);
+	int descr_len = strlen(str);
+	int stag_len = strlen(".avg");
+	int sdescr_len = strlen(", avg.");
+
+	stag_len = (tag_len + stag_len < 40) ? 40 - tag_len : stag_len;
+	sdescr_len = (descr_len + sdescr_len < 50) ? 50 - descr_len : sdescr_len;
+
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".avg", str,
+	       sdescr_len, ", avg.", cycles, (uint32_t)timing_cycles_to_ns(cycles));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-50s : %7llu cycles (%7u nsec)\n", str, cycles,
+	       (uint32_t)timing_cycles_to_ns(cycles));
+#endif
+}
+
+static void run_size(int num_threads)
+{
+	uint64_t cycles;
+	char tag[40];
+	char str[50];
+
+	cycles = run_threads(OP_READ_LOCK, num_threads);
+	snprintk(tag, sizeof(tag), "rwlock.read.%d", num_threads);
+	snprintk(str, sizeof(str), "Read lock/unlock rwlock, %d threads", num_threads);
+	report(tag, str, cycles);
+
+	cycles = run_threads(OP_MUTEX, num_threads);
+	snprintk(tag, sizeof(tag), "rwlock.mutex.%d", num_threads);
+	snprintk(str, sizeof(str), "Lock/unlock mutex, %d threads", num_threads);
+	report(tag, str, cycles);
+
+	cycles = run_threads(OP_WRITE_LOCK, num_threads);
+	snprintk(tag, sizeof(tag), "rwlock.write.%d", num_threads);
+	snprintk(str, sizeof(str), "Write lock/unlock rwlock, %d threads", num_threads);
+	report(tag, str, cycles);
+}
+
+int main(void)
+{
+	timing_init();
+
+	k_rwlock_init(&rwlock);
+	k_mutex_init(&mutex);
+
+	printk("Reader-writer lock scalability\n");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	for (int i = 1; i <= MAX_THREADS; i++) {
+		run_size(i);
+	}
+
+	timing_stop();
+
+	if (shared_data != MAX_THREADS * (MAX_THREADS + 1) / 2 *
+			   CONFIG_BENCHMARK_NUM_ITERATIONS) {
+		printk("Writers lost updates\n");
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
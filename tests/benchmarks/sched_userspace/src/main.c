@@ -117,6 +117,37 @@ static int exec_test(uint8_t nb_threads)
 }
 
 
+#ifdef CONFIG_SYSCALL_BATCH
+static K_SEM_DEFINE(batch_sem, 0, 1);
+static K_MSGQ_DEFINE(batch_msgq, sizeof(uint32_t), 1, 4);
+
+static void exec_syscalls(const char *name, k_thread_entry_t entry,
+			  uint32_t batch_size)
+{
+	k_tid_t tid;
+
+	tid = k_thread_create(&app_threads[0].thread, app_thread_stacks[0],
+			      APP_STACKSIZE, entry, &batch_sem, &batch_msgq,
+			      (void *)(uintptr_t)batch_size, THREADS_PRIO,
+			      K_USER, K_FOREVER);
+	k_thread_access_grant(tid, &batch_sem, &batch_msgq);
+
+	k_thread_priority_set(k_current_get(), MAIN_PRIO);
+
+	stamp(MEAS_START);
+	k_thread_start(tid);
+	k_thread_join(tid, K_FOREVER);
+	stamp(MEAS_END);
+
+	uint32_t full_time = stamps[MEAS_END] - stamps[MEAS_START];
+	uint64_t time_ns = k_cyc_to_ns_near64(full_time) / NB_SYSCALLS;
+
+	printk("%-10s batch of %2u: %8" PRIu32 " cyc & %6" PRIu32 " calls -> %6"
+	       PRIu64 " ns per call\n", name, batch_size, full_time, NB_SYSCALLS,
+	       time_ns);
+}
+#endif /* CONFIG_SYSCALL_BATCH */
+
 int main(void)
 {
 	int ret;
@@ -136,6 +167,18 @@ int main(void)
 		}
 	}
 
+#ifdef CONFIG_SYSCALL_BATCH
+	uint32_t batch_sizes[] = {SYSCALLS_PER_ROUND, 8, MAX_BATCH_SIZE};
+
+	printk("============================\n");
+	printk("user semaphore and message queue calls\n");
+
+	exec_syscalls("single", syscall_single, 1);
+	for (size_t i = 0; i < ARRAY_SIZE(batch_sizes); i++) {
+		exec_syscalls("batched", syscall_batched, batch_sizes[i]);
+	}
+#endif /* CONFIG_SYSCALL_BATCH */
+
 	printk("SUCCESS\n");
 	return 0;
 }
@@ -7,6 +7,9 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <zephyr/kernel.h>
+#ifdef CONFIG_SYSCALL_BATCH
+#include <zephyr/sys/syscall_batch.h>
+#endif
 
 #include "user.h"
 
@@ -19,3 +22,45 @@ void context_switch_yield(void *p1, void *p2, void *p3)
 		k_yield();
 	}
 }
+
+#ifdef CONFIG_SYSCALL_BATCH
+void syscall_single(void *p1, void *p2, void *p3)
+{
+	struct k_sem *sem = p1;
+	struct k_msgq *msgq = p2;
+	uint32_t msg = 0;
+	uint32_t rounds = NB_SYSCALLS / SYSCALLS_PER_ROUND;
+
+	while (rounds--) {
+		k_sem_give(sem);
+		(void)k_sem_take(sem, K_NO_WAIT);
+		(void)k_msgq_put(msgq, &msg, K_NO_WAIT);
+		(void)k_msgq_get(msgq, &msg, K_NO_WAIT);
+	}
+}
+
+void syscall_batched(void *p1, void *p2, void *p3)
+{
+	struct k_sem *sem = p1;
+	struct k_msgq *msgq = p2;
+	uint32_t batch_size = (uint32_t)(uintptr_t)p3;
+	struct k_syscall_batch_entry entries[MAX_BATCH_SIZE];
+	uint32_t msg = 0;
+	uint32_t rounds = NB_SYSCALLS / batch_size;
+
+	for (uint32_t i = 0; i < batch_size; i += SYSCALLS_PER_ROUND) {
+		entries[i] = (struct k_syscall_batch_entry)
+			K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_GIVE, sem, 0);
+		entries[i + 1] = (struct k_syscall_batch_entry)
+			K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_TAKE, sem, 0);
+		entries[i + 2] = (struct k_syscall_batch_entry)
+			K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_MSGQ_PUT, msgq, &msg);
+		entries[i + 3] = (struct k_syscall_batch_entry)
+			K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_MSGQ_GET, msgq, &msg);
+	}
+
+	while (rounds--) {
+		(void)k_syscall_batch(entries, batch_size);
+	}
+}
+#endif /* CONFIG_SYSCALL_BATCH */
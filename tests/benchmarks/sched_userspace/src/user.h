@@ -6,4 +6,10 @@
 
 #define NB_YIELDS UINT32_C(1000000)
 
+#define NB_SYSCALLS UINT32_C(100000)
+#define SYSCALLS_PER_ROUND 4
+#define MAX_BATCH_SIZE 32
+
 void context_switch_yield(void *p1, void *p2, void *p3);
+void syscall_single(void *p1, void *p2, void *p3);
+void syscall_batched(void *p1, void *p2, void *p3);
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures the average and worst-case time of sys_heap allocations and
+ * frees while the heap ages with random operations, and the resulting
+ * fragmentation of the heap.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define HEAP_SIZE  CONFIG_BENCHMARK_HEAP_SIZE
+#define MAX_BLOCKS CONFIG_BENCHMARK_MAX_BLOCKS
+
+struct op_stats {
+	uint64_t total;
+	uint64_t max;
+	uint32_t count;
+};
+
+static uint8_t __aligned(8) heap_mem[HEAP_SIZE];
+static struct sys_heap heap;
+
+static void *blocks[MAX_BLOCKS];
+static size_t block_sizes[MAX_BLOCKS];
+static unsigned int num_blocks;
+static size_t bytes_in_use;
+
+static struct op_stats alloc_stats;
+static struct op_stats free_stats;
+static uint32_t failed_allocs;
+
+/* Same LCRNG as the heap stress test, for repeatable runs */
+static uint32_t rand32(void)
+{
+	static uint64_t state = 123456789;
+
+	state = state * 2862933555777941757ULL + 3037000493ULL;
+
+	return (uint32_t)(state >> 32);
+}
+
+/* Sizes from 1 byte to a quarter of the heap, smaller ones being
+ * exponentially more frequent
+ */
+static size_t rand_size(void)
+{
+	unsigned int scale = 3 + (rand32() % (LOG2(HEAP_SIZE / 4) - 2));
+
+	return 1 + (rand32() & BIT_MASK(scale));
+}
+
+static void record(struct op_stats *stats, timing_t *start, timing_t *finish)
+{
+	uint64_t cycles = timing_cycles_get(start, finish);
+
+	stats->total += cycles;
+	stats->max = MAX(stats->max, cycles);
+	stats->count++;
+}
+
+static void do_alloc(void)
+{
+	size_t size = rand_size();
+	timing_t start;
+	timing_t finish;
+	void *mem;
+
+	start = timing_counter_get();
+	mem = sys_heap_alloc(&heap, size);
+	finish = timing_counter_get();
+
+	record(&alloc_stats, &start, &finish);
+
+	if (mem == NULL) {
+		failed_allocs++;
+		return;
+	}
+
+	blocks[num_blocks] = mem;
+	block_sizes[num_blocks] = size;
+	num_blocks++;
+	bytes_in_use += size;
+}
+
+static void do_free(void)
+{
+	unsigned int i = rand32() % num_blocks;
+	timing_t start;
+	timing_t finish;
+
+	start = timing_counter_get();
+	sys_heap_free(&heap, blocks[i]);
+	finish = timing_counter_get();
+
+	record(&free_stats, &start, &finish);
+
+	bytes_in_use -= block_sizes[i];
+	num_blocks--;
+	blocks[i] = blocks[num_blocks];
+	block_sizes[i] = block_sizes[num_blocks];
+}
+
+/* Largest block the heap can currently allocate */
+static size_t largest_block(void)
+{
+	size_t low = 0;
+	size_t high = HEAP_SIZE;
+
+	while (low < high) {
+		size_t size = (low + high + 1) / 2;
+		void *mem = sys_heap_alloc(&heap, size);
+
+		if (mem != NULL) {
+			sys_heap_free(&heap, mem);
+			low = size;
+		} else {
+			high = size - 1;
+		}
+	}
+
+	return low;
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles)
+{
+#ifdef CONFIG_BENCHMARK_RECORDING
+	int tag_len = strlen(tag);
+	int descr_len = strlen(str);
+	int stag_len = strlen(".avg");
+	int sdescr_len = strlen(", avg.");
+
+	stag_len = (tag_len + stag_len < 40) ? 40 - tag_len : stag_len;
+	sdescr_len = (descr_len + sdescr_len < 50) ? 50 - descr_len : sdescr_len;
+
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".avg", str,
+	       sdescr_len, ", avg.", cycles, (uint32_t)timing_cycles_to_ns(cycles));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-50s : %7llu cycles (%7u nsec)\n", str, cycles,
+	       (uint32_t)timing_cycles_to_ns(cycles));
+#endif
+}
+
+int main(void)
+{
+	struct sys_memory_stats stats;
+	uint32_t target = (uint32_t)((uint64_t)HEAP_SIZE * CONFIG_BENCHMARK_FILL_PERCENT / 100);
+	size_t largest;
+	unsigned int i;
+	bool valid;
+
+	timing_init();
+
+	printk("System heap fragmentation and latency (%s)\n",
+	       IS_ENABLED(CONFIG_SYS_HEAP_TLSF) ? "two-level segregated fit" : "bucket search");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+	printk("%u byte heap, %u operations, %u%% target usage\n", HEAP_SIZE,
+	       CONFIG_BENCHMARK_NUM_OPERATIONS, CONFIG_BENCHMARK_FILL_PERCENT);
+
+	sys_heap_init(&heap, heap_mem, HEAP_SIZE);
+
+	timing_start();
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_OPERATIONS; i++) {
+		if ((num_blocks == 0) ||
+		    ((num_blocks < MAX_BLOCKS) && (bytes_in_use < target) && (rand32() & 1))) {
+			do_alloc();
+		} else {
+			do_free();
+		}
+	}
+
+	timing_stop();
+
+	report("sys_heap.alloc", "Allocate a block", alloc_stats.total / alloc_stats.count);
+	report("sys_heap.alloc.max", "Allocate a block, worst case", alloc_stats.max);
+	report("sys_heap.free", "Free a block", free_stats.total / free_stats.count);
+	report("sys_heap.free.max", "Free a block, worst case", free_stats.max);
+
+	sys_heap_runtime_stats_get(&heap, &stats);
+	largest = largest_block();
+
+	printk("Failed allocations: %u/%u (%u%%)\n", failed_allocs, alloc_stats.count,
+	       (100U * failed_allocs) / alloc_stats.count);
+	printk("Free memory: %zu bytes, largest block: %zu bytes, fragmentation: %u%%\n",
+	       stats.free_bytes, largest,
+	       (stats.free_bytes == 0) ? 0U :
+	       (uint32_t)(100U - (100U * largest) / stats.free_bytes));
+
+	while (num_blocks > 0) {
+		do_free();
+	}
+
+	valid = sys_heap_validate(&heap);
+	if (!valid) {
+		printk("Heap is corrupted\n");
+	}
+
+	TC_END_REPORT(valid ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains the main testing module that invokes all the tests.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timestamp.h>
+#include "utils.h"
+#include <zephyr/tc_util.h>
+#include <timeout_q.h>
+
+/*
+ * All timeouts are armed far enough in the future, and the tick rate is
+ * low enough, that none of them ever expires while being measured.
+ */
+#define TIMEOUT_BASE_TICKS 1000000
+
+uint32_t tm_off;
+
+static struct _timeout test_timeout[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+
+static uint64_t add_cycles[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+static uint64_t abort_cycles[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+
+static void test_expiry(struct _timeout *t)
+{
+	printk("Timeout %u unexpectedly expired\n",
+	       (unsigned int)(t - &test_timeout[0]));
+}
+
+static void cycles_reset(unsigned int num_timeouts)
+{
+	unsigned int i;
+
+	for (i = 0; i < num_timeouts; i++) {
+		add_cycles[i] = 0ULL;
+		abort_cycles[i] = 0ULL;
+	}
+}
+
+/*
+ * Each new timeout expires after all those already queued, and the
+ * soonest one is aborted first.
+ */
+static void test_increasing_expiry(unsigned int num_timeouts)
+{
+	unsigned int i;
+	timing_t start;
+	timing_t finish;
+
+	for (i = 0; i < num_timeouts; i++) {
+		start = timing_counter_get();
+		z_add_timeout(&test_timeout[i], test_expiry,
+			      K_TICKS(TIMEOUT_BASE_TICKS + i));
+		finish = timing_counter_get();
+		add_cycles[i] += timing_cycles_get(&start, &finish);
+	}
+
+	for (i = 0; i < num_timeouts; i++) {
+		start = timing_counter_get();
+		z_abort_timeout(&test_timeout[i]);
+		finish = timing_counter_get();
+		abort_cycles[num_timeouts - i - 1] += timing_cycles_get(&start, &finish);
+	}
+}
+
+/*
+ * Each new timeout expires before all those already queued, and the
+ * latest one is aborted first.
+ */
+static void test_decreasing_expiry(unsigned int num_timeouts)
+{
+	unsigned int i;
+	timing_t start;
+	timing_t finish;
+
+	for (i = 0; i < num_timeouts; i++) {
+		start = timing_counter_get();
+		z_add_timeout(&test_timeout[i], test_expiry,
+			      K_TICKS(TIMEOUT_BASE_TICKS + num_timeouts - i));
+		finish = timing_counter_get();
+		add_cycles[i] += timing_cycles_get(&start, &finish);
+	}
+
+	for (i = 0; i < num_timeouts; i++) {
+		start = timing_counter_get();
+		z_abort_timeout(&test_timeout[i]);
+		finish = timing_counter_get();
+		abort_cycles[num_timeouts - i - 1] += timing_cycles_get(&start, &finish);
+	}
+}
+
+static uint64_t sqrt_u64(uint64_t square)
+{
+	if (square > 1) {
+		uint64_t lo = sqrt_u64(square >> 2) << 1;
+		uint64_t hi = lo + 1;
+
+		return ((hi * hi) > square) ? lo : hi;
+	}
+
+	return square;
+}
+
+static void compute_and_report_stats(unsigned int num_timeouts, unsigned int num_iterations,
+				     uint64_t *cycles, const char *tag, const char *str)
+{
+	uint64_t minimum = cycles[0];
+	uint64_t maximum = cycles[0];
+	uint64_t total = cycles[0];
+	uint64_t average;
+	uint64_t std_dev = 0;
+	uint64_t tmp;
+	uint64_t diff;
+	unsigned int i;
+
+	for (i = 1; i < num_timeouts; i++) {
+		if (cycles[i] > maximum) {
+			maximum = cycles[i];
+		}
+
+		if (cycles[i] < minimum) {
+			minimum = cycles[i];
+		}
+
+		total += cycles[i];
+	}
+
+	minimum /= (uint64_t)num_iterations;
+	maximum /= (uint64_t)num_iterations;
+	average = total / (num_timeouts * num_iterations);
+
+	for (i = 0; i < num_timeouts; i++) {
+		tmp = cycles[i] / num_iterations;
+		diff = (average > tmp) ? (average - tmp) : (tmp - average);
+
+		std_dev += (diff * diff);
+	}
+	std_dev /= num_timeouts;
+	std_dev = sqrt_u64(std_dev);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	int tag_len = strlen(tag);
+	int descr_len = strlen(str);
+	int stag_len = strlen(".stddev");
+	int sdescr_len = strlen(", stddev.");
+
+	stag_len = (tag_len + stag_len < 40) ? 40 - tag_len : stag_len;
+	sdescr_len = (descr_len + sdescr_len < 50) ? 50 - descr_len : sdescr_len;
+
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".min", str,
+	       sdescr_len, ", min.", minimum, (uint32_t)timing_cycles_to_ns(minimum));
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".max", str,
+	       sdescr_len, ", max.", maximum, (uint32_t)timing_cycles_to_ns(maximum));
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".avg", str,
+	       sdescr_len, ", avg.", average, (uint32_t)timing_cycles_to_ns(average));
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".stddev", str,
+	       sdescr_len, ", stddev.", std_dev, (uint32_t)timing_cycles_to_ns(std_dev));
+#else
+	ARG_UNUSED(tag);
+
+	printk("------------------------------------\n");
+	printk("%s\n", str);
+
+	printk("    Minimum : %7llu cycles (%7u nsec)\n", minimum,
+	       (uint32_t)timing_cycles_to_ns(minimum));
+	printk("    Maximum : %7llu cycles (%7u nsec)\n", maximum,
+	       (uint32_t)timing_cycles_to_ns(maximum));
+	printk("    Average : %7llu cycles (%7u nsec)\n", average,
+	       (uint32_t)timing_cycles_to_ns(average));
+	printk("    Std Deviation: %7llu cycles (%7u nsec)\n", std_dev,
+	       (uint32_t)timing_cycles_to_ns(std_dev));
+#endif
+}
+
+#ifdef CONFIG_BENCHMARK_VERBOSE
+static void report_verbose(uint64_t *cycles, const char *tag_fmt, const char *str)
+{
+	char description[120];
+	char tag[50];
+	unsigned int i;
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_TIMEOUTS; i++) {
+		snprintf(tag, sizeof(tag), tag_fmt, i);
+		snprintf(description, sizeof(description), "%-40s - %s", tag, str);
+		PRINT_STATS_AVG(description, (uint32_t)cycles[i],
+				CONFIG_BENCHMARK_NUM_ITERATIONS);
+	}
+}
+#else
+#define report_verbose(cycles, tag_fmt, str) do {} while (false)
+#endif
+
+int main(void)
+{
+	unsigned int i;
+	unsigned int freq;
+
+	timing_init();
+
+	bench_test_init();
+
+	freq = timing_freq_get_mhz();
+
+	printk("Time Measurements for %s timeout queue\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_QUEUE_SCALABLE) ? "scalable" : "simple");
+	printk("Timing results: Clock frequency: %u MHz\n", freq);
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_TIMEOUTS; i++) {
+		z_init_timeout(&test_timeout[i]);
+	}
+
+	timing_start();
+
+	cycles_reset(CONFIG_BENCHMARK_NUM_TIMEOUTS);
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		test_increasing_expiry(CONFIG_BENCHMARK_NUM_TIMEOUTS);
+	}
+
+	compute_and_report_stats(CONFIG_BENCHMARK_NUM_TIMEOUTS, CONFIG_BENCHMARK_NUM_ITERATIONS,
+				 add_cycles, "timeout.add.TimeoutQ_tail",
+				 "Add timeouts of increasing expiry");
+	report_verbose(add_cycles, "TimeoutQ.add.to.tail.%04u.pending",
+		       "Add latest timeout");
+
+	compute_and_report_stats(CONFIG_BENCHMARK_NUM_TIMEOUTS, CONFIG_BENCHMARK_NUM_ITERATIONS,
+				 abort_cycles, "timeout.abort.TimeoutQ_head",
+				 "Abort timeouts of increasing expiry");
+	report_verbose(abort_cycles, "TimeoutQ.abort.from.head.%04u.pending",
+		       "Abort soonest timeout");
+
+	cycles_reset(CONFIG_BENCHMARK_NUM_TIMEOUTS);
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		test_decreasing_expiry(CONFIG_BENCHMARK_NUM_TIMEOUTS);
+	}
+
+	compute_and_report_stats(CONFIG_BENCHMARK_NUM_TIMEOUTS, CONFIG_BENCHMARK_NUM_ITERATIONS,
+				 add_cycles, "timeout.add.TimeoutQ_head",
+				 "Add timeouts of decreasing expiry");
+	report_verbose(add_cycles, "TimeoutQ.add.to.head.%04u.pending",
+		       "Add soonest timeout");
+
+	compute_and_report_stats(CONFIG_BENCHMARK_NUM_TIMEOUTS, CONFIG_BENCHMARK_NUM_ITERATIONS,
+				 abort_cycles, "timeout.abort.TimeoutQ_tail",
+				 "Abort timeouts of decreasing expiry");
+	report_verbose(abort_cycles, "TimeoutQ.abort.from.tail.%04u.pending",
+		       "Abort latest timeout");
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
@@ -33,6 +33,8 @@ static _wait_q_t wait_q;
 
 uint64_t add_cycles[CONFIG_BENCHMARK_NUM_THREADS];
 uint64_t remove_cycles[CONFIG_BENCHMARK_NUM_THREADS];
+uint64_t wake_one_cycles;
+uint64_t wake_all_cycles;
 
 /**
  * Initialize each dummy thread.
@@ -125,6 +127,42 @@ static void test_increasing_priority(_wait_q_t *q, unsigned int num_threads)
 	}
 }
 
+/**
+ * All the dummy threads in the wait queue are woken up, first one by one,
+ * then all at once.
+ */
+static void test_wake_all(_wait_q_t *q, unsigned int num_threads)
+{
+	unsigned int i;
+	timing_t start;
+	timing_t finish;
+	struct k_thread *thread;
+
+	for (i = 0; i < num_threads; i++) {
+		z_pend_thread((struct k_thread *)&dummy_thread[i],
+			      q, K_FOREVER);
+	}
+
+	start = timing_counter_get();
+	for (thread = z_unpend_first_thread(q); thread != NULL;
+	     thread = z_unpend_first_thread(q)) {
+		z_ready_thread(thread);
+	}
+	finish = timing_counter_get();
+
+	wake_one_cycles += timing_cycles_get(&start, &finish);
+
+	for (i = 0; i < num_threads; i++) {
+		z_pend_thread((struct k_thread *)&dummy_thread[i],
+			      q, K_FOREVER);
+	}
+
+	start = timing_counter_get();
+	(void)z_unpend_all(q);
+	finish = timing_counter_get();
+
+	wake_all_cycles += timing_cycles_get(&start, &finish);
+}
 
 static uint64_t sqrt_u64(uint64_t square)
 {
@@ -318,6 +356,21 @@ int main(void)
 	}
 #endif
 
+	wake_one_cycles = 0ULL;
+	wake_all_cycles = 0ULL;
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		test_wake_all(&wait_q, CONFIG_BENCHMARK_NUM_THREADS);
+	}
+
+	compute_and_report_stats(1, CONFIG_BENCHMARK_NUM_ITERATIONS,
+				 &wake_one_cycles, "sched.wake.one.WaitQ",
+				 "Wake all threads one by one");
+
+	compute_and_report_stats(1, CONFIG_BENCHMARK_NUM_ITERATIONS,
+				 &wake_all_cycles, "sched.wake.all.WaitQ",
+				 "Wake all threads at once");
+
 	timing_stop();
 
 	TC_END_REPORT(0);
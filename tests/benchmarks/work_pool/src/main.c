@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures the cost of running batches of empty, computing and sleeping
+ * work items on the single thread system work queue and on a work queue
+ * animated by a pool of threads.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define NUM_ITEMS   CONFIG_BENCHMARK_NUM_ITEMS
+#define NUM_WORKERS CONFIG_BENCHMARK_NUM_WORKERS
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_ARRAY_DEFINE(pool_stacks, NUM_WORKERS, STACK_SIZE);
+static struct k_work_q_worker pool_workers[NUM_WORKERS];
+static struct k_work_q pool;
+
+static struct k_work bench_work[NUM_ITEMS];
+
+static K_SEM_DEFINE(done_sem, 0, NUM_ITEMS);
+
+static atomic_t errors;
+
+static void empty_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_sem_give(&done_sem);
+}
+
+static void busy_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_busy_wait(CONFIG_BENCHMARK_WORK_US);
+	k_sem_give(&done_sem);
+}
+
+static void sleep_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_usleep(CONFIG_BENCHMARK_WORK_US);
+	k_sem_give(&done_sem);
+}
+
+static uint64_t run_items(struct k_work_q *queue, k_work_handler_t handler)
+{
+	timing_t start;
+	timing_t finish;
+	unsigned int i;
+	unsigned int j;
+
+	for (i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&bench_work[i], handler);
+	}
+
+	start = timing_counter_get();
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		for (j = 0; j < NUM_ITEMS; j++) {
+			if (k_work_submit_to_queue(queue, &bench_work[j]) != 1) {
+				atomic_inc(&errors);
+				k_sem_give(&done_sem);
+			}
+		}
+
+		/* an item cannot be submitted again before it has run */
+		for (j = 0; j < NUM_ITEMS; j++) {
+			k_sem_take(&done_sem, K_FOREVER);
+		}
+	}
+
+	finish = timing_counter_get();
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles)
+{
+#ifdef CONFIG_BENCHMARK_RECORDING
+	int tag_len = strlen(tag);
+	int descr_len = strlen(str);
+	int stag_len = strlen(".avg");
+	int sdescr_len = strlen(", avg.");
+
+	stag_len = (tag_len + stag_len < 40) ? 40 - tag_len : stag_len;
+	sdescr_len = (descr_len + sdescr_len < 50) ? 50 - descr_len : sdescr_len;
+
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".avg", str,
+	       sdescr_len, ", avg.", cycles, (uint32_t)timing_cycles_to_ns(cycles));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-50s : %7llu cycles (%7u nsec)\n", str, cycles,
+	       (uint32_t)timing_cycles_to_ns(cycles));
+#endif
+}
+
+static void run_queue(struct k_work_q *queue, const char *name)
+{
+	static const struct {
+		const char *name;
+		k_work_handler_t handler;
+	} kinds[] = {
+		{ "empty", empty_handler },
+		{ "busy", busy_handler },
+		{ "sleep", sleep_handler },
+	};
+	uint64_t num_runs = (uint64_t)CONFIG_BENCHMARK_NUM_ITERATIONS * NUM_ITEMS;
+	uint64_t cycles;
+	char tag[40];
+	char str[50];
+
+	for (size_t i = 0; i < ARRAY_SIZE(kinds); i++) {
+		cycles = run_items(queue, kinds[i].handler);
+		snprintk(tag, sizeof(tag), "work_pool.%s.%s", name, kinds[i].name);
+		snprintk(str, sizeof(str), "Run one %s work item, %s queue", kinds[i].name, name);
+		report(tag, str, cycles / num_runs);
+	}
+}
+
+int main(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "bench_pool",
+		.pin_workers = IS_ENABLED(CONFIG_SCHED_CPU_MASK),
+	};
+
+	timing_init();
+
+	printk("Work queue pool throughput\n");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+	printk("%u CPUs, %u workers, batches of %u items, slow items take %u us\n",
+	       arch_num_cpus(), NUM_WORKERS, NUM_ITEMS, CONFIG_BENCHMARK_WORK_US);
+
+	/* the pool runs at the priority of the system work queue */
+	k_work_queue_init(&pool);
+	k_work_queue_start_pool(&pool, pool_workers, NUM_WORKERS, pool_stacks[0], STACK_SIZE,
+				CONFIG_SYSTEM_WORKQUEUE_PRIORITY, &cfg);
+
+	timing_start();
+
+	run_queue(&k_sys_work_q, "system");
+	run_queue(&pool, "pool");
+
+	timing_stop();
+
+	(void)k_work_queue_drain(&pool, true);
+	if (k_work_queue_stop(&pool, K_FOREVER) != 0) {
+		printk("Failed to stop the pool\n");
+		atomic_inc(&errors);
+	}
+
+	if (atomic_get(&errors) != 0) {
+		printk("%ld submissions failed\n", (long)atomic_get(&errors));
+	}
+
+	TC_END_REPORT(atomic_get(&errors) == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
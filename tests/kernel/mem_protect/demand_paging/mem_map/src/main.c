@@ -105,6 +105,8 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 #ifndef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	printk("    - in ISR: %lu\n", stats->pagefaults.in_isr);
 #endif
+	printk("    - Cycles: %lu (longest %lu)\n", stats->pagefaults.cycles,
+	       stats->pagefaults.longest_cycles);
 
 	printk("* Eviction (%s):\n", scope);
 	printk("    - Total pages evicted: %lu\n",
@@ -113,6 +115,13 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+	printk("    - Pages evicted in the background: %lu\n",
+	       stats->eviction.background);
+
+	printk("* Read-ahead (%s):\n", scope);
+	printk("    - Sequential page faults: %lu\n",
+	       stats->read_ahead.sequential);
+	printk("    - Pages read ahead: %lu\n", stats->read_ahead.pages);
 }
 
 static void touch_anon_pages(bool zig, bool zag)
@@ -252,9 +261,16 @@ static void test_k_mem_page_out(void)
 	faults = k_mem_num_pagefaults_get() - faults;
 	irq_unlock(key);
 
-	zassert_equal(faults, HALF_PAGES,
-		      "unexpected num pagefaults expected %lu got %d",
-		      HALF_PAGES, faults);
+	if (CONFIG_DEMAND_PAGING_READ_AHEAD == 0) {
+		zassert_equal(faults, HALF_PAGES,
+			      "unexpected num pagefaults expected %lu got %d",
+			      HALF_PAGES, faults);
+	} else {
+		/* Sequential writes, the pages are read ahead */
+		zassert_true((faults > 0) && (faults < HALF_PAGES),
+			     "unexpected num pagefaults %d with read-ahead",
+			     faults);
+	}
 
 	ret = k_mem_page_out(arena, arena_size);
 	zassert_equal(ret, -ENOMEM, "k_mem_page_out should have failed");
@@ -328,6 +344,63 @@ ZTEST(demand_paging_api, test_k_mem_unpin)
 	test_k_mem_page_out();
 }
 
+ZTEST(demand_paging_api, test_read_ahead)
+{
+	struct k_mem_paging_stats_t before, after;
+	unsigned long faults;
+	unsigned int key;
+	int ret;
+
+	if (CONFIG_DEMAND_PAGING_READ_AHEAD == 0) {
+		ztest_test_skip();
+	}
+
+	key = irq_lock();
+
+	ret = k_mem_page_out(arena, HALF_BYTES);
+	zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
+
+	k_mem_paging_stats_get(&before);
+
+	/* Read one byte per page, in order */
+	faults = k_mem_num_pagefaults_get();
+	for (size_t i = 0; i < HALF_BYTES; i += CONFIG_MMU_PAGE_SIZE) {
+		zassert_equal(arena[i], nums[i % 10], "arena corrupted at %zu", i);
+	}
+	faults = k_mem_num_pagefaults_get() - faults;
+
+	k_mem_paging_stats_get(&after);
+	irq_unlock(key);
+
+	printk("%lu page faults for %lu pages, %lu pages read ahead\n",
+	       faults, HALF_PAGES,
+	       after.read_ahead.pages - before.read_ahead.pages);
+
+	zassert_true(faults < HALF_PAGES, "no page read ahead");
+	zassert_true(faults + (after.read_ahead.pages - before.read_ahead.pages) >=
+		     HALF_PAGES, "pages neither faulted nor read ahead");
+}
+
+ZTEST(demand_paging_api, test_background_eviction)
+{
+	struct k_mem_paging_stats_t stats;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_DEMAND_PAGING_BACKGROUND_EVICTION);
+
+	/* Use up the free page frames */
+	for (size_t i = 0; i < arena_size; i += CONFIG_MMU_PAGE_SIZE) {
+		arena[i] = nums[i % 10];
+	}
+
+	/* Let the eviction thread run */
+	k_msleep(100);
+
+	k_mem_paging_stats_get(&stats);
+	print_paging_stats(&stats, "kernel");
+	zassert_not_equal(stats.eviction.background, 0UL,
+			  "no page evicted in the background");
+}
+
 /* Show that even if we map enough anonymous memory to fill the backing
  * store, we can still handle pagefaults.
  * This eats up memory so should be last in the suite.
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/syscall_batch.h>
+
+#define MSG_VALUE 0x5a5a1234U
+
+static K_SEM_DEFINE(batch_sem, 0, 1);
+static K_SEM_DEFINE(denied_sem, 0, 1);
+K_MSGQ_DEFINE(batch_msgq, sizeof(uint32_t), 1, 4);
+static struct k_poll_signal batch_signal;
+
+/**
+ * @brief Test that every operation of a batch runs and reports its result
+ *
+ * @see k_syscall_batch()
+ */
+ZTEST_USER(syscall_batch, test_batch_results)
+{
+	uint32_t msg_in = MSG_VALUE;
+	uint32_t msg_out = 0U;
+	unsigned int signaled;
+	int result;
+	struct k_syscall_batch_entry entries[] = {
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_GIVE, &batch_sem, 0),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_TAKE, &batch_sem, 0),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_TAKE, &batch_sem, 0),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_MSGQ_PUT, &batch_msgq, &msg_in),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_MSGQ_PUT, &batch_msgq, &msg_in),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_MSGQ_GET, &batch_msgq, &msg_out),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_POLL_SIGNAL_RAISE, &batch_signal, 7),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_LIMIT, &batch_sem, 0),
+	};
+
+	/* The second take finds no count, and the second put a full queue */
+	zassert_equal(k_syscall_batch(entries, ARRAY_SIZE(entries)), 3);
+
+	zassert_equal(entries[0].ret, 0);
+	zassert_equal(entries[1].ret, 0);
+	zassert_equal(entries[2].ret, -EBUSY);
+	zassert_equal(entries[3].ret, 0);
+	zassert_equal(entries[4].ret, -ENOMSG);
+	zassert_equal(entries[5].ret, 0);
+	zassert_equal(entries[6].ret, 0);
+	zassert_equal(entries[7].ret, -ENOSYS);
+
+	zassert_equal(msg_out, MSG_VALUE);
+	zassert_equal(k_sem_count_get(&batch_sem), 0);
+	zassert_equal(k_msgq_num_used_get(&batch_msgq), 0);
+
+	k_poll_signal_check(&batch_signal, &signaled, &result);
+	zassert_equal(signaled, 1);
+	zassert_equal(result, 7);
+	k_poll_signal_reset(&batch_signal);
+}
+
+/**
+ * @brief Test that a user thread cannot reach an object it has no access to
+ *
+ * @see k_syscall_batch()
+ */
+ZTEST_USER(syscall_batch, test_batch_denied)
+{
+	struct k_syscall_batch_entry entries[] = {
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_GIVE, &denied_sem, 0),
+	};
+
+	if (!k_is_user_context()) {
+		ztest_test_skip();
+	}
+
+	ztest_set_fault_valid(true);
+	(void)k_syscall_batch(entries, ARRAY_SIZE(entries));
+
+	zassert_unreachable("Batch on an object without access did not fault");
+}
+
+static void *syscall_batch_setup(void)
+{
+	k_poll_signal_init(&batch_signal);
+	k_thread_access_grant(k_current_get(), &batch_sem, &batch_msgq,
+			      &batch_signal);
+
+	return NULL;
+}
+
+ZTEST_SUITE(syscall_batch, NULL, syscall_batch_setup, NULL, NULL, NULL);
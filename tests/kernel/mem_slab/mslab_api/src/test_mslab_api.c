@@ -338,3 +338,51 @@ ZTEST(mslab_api, test_mslab_pending)
 	/* Free memory block */
 	k_mem_slab_free(&kmslab, b);
 }
+
+/**
+ * @brief Verify allocation and freeing of several blocks at once
+ *
+ * @details Allocate more blocks than available with
+ * @see k_mem_slab_alloc_bulk() and check that only the available
+ * blocks are returned, that a further bulk allocation fails, and
+ * that the used and free block counts follow. Then free all
+ * blocks with @see k_mem_slab_free_bulk().
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_api, test_mslab_alloc_free_bulk)
+{
+	void *block[BLK_NUM + 1];
+
+	zassert_equal(k_mem_slab_alloc_bulk(&mslab, block, 0, K_NO_WAIT), -EINVAL);
+
+	zassert_equal(k_mem_slab_alloc_bulk(&mslab, block, 2, K_NO_WAIT), 2);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), 2);
+	zassert_equal(k_mem_slab_alloc_bulk(&mslab, &block[2], 2, K_NO_WAIT), BLK_NUM - 2);
+	zassert_equal(k_mem_slab_num_free_get(&mslab), 0);
+
+	for (int i = 0; i < BLK_NUM; i++) {
+		zassert_true(((char *)block[i] >= tslab) &&
+			     ((char *)block[i] < tslab + sizeof(tslab)));
+		for (int j = 0; j < i; j++) {
+			zassert_not_equal(block[i], block[j], "block allocated twice");
+		}
+	}
+
+	zassert_equal(k_mem_slab_alloc_bulk(&mslab, &block[BLK_NUM], 1, K_NO_WAIT), -ENOMEM);
+	if (IS_ENABLED(CONFIG_MULTITHREADING)) {
+		zassert_equal(k_mem_slab_alloc_bulk(&mslab, &block[BLK_NUM], 1, K_MSEC(20)),
+			      -EAGAIN);
+	}
+
+	k_mem_slab_free_bulk(&mslab, block, BLK_NUM);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), 0);
+	zassert_equal(k_mem_slab_num_free_get(&mslab), BLK_NUM);
+
+	/* single and bulk operations can be mixed */
+	zassert_equal(k_mem_slab_alloc_bulk(&mslab, block, BLK_NUM, K_NO_WAIT), BLK_NUM);
+	for (int i = 0; i < BLK_NUM; i++) {
+		k_mem_slab_free(&mslab, block[i]);
+	}
+	tmslab_alloc_free(&mslab);
+}
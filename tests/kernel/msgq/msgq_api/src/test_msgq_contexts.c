@@ -6,8 +6,13 @@
 
 #include "test_msgq.h"
 
+#if defined(CONFIG_MSGQ_LOCKFREE) && !defined(CONFIG_TEST_MSGQ_PUT_FRONT)
+/**TESTPOINT: init via K_MSGQ_LOCKFREE_DEFINE*/
+K_MSGQ_LOCKFREE_DEFINE(kmsgq, MSG_SIZE, MSGQ_LEN, 4);
+#else
 /**TESTPOINT: init via K_MSGQ_DEFINE*/
 K_MSGQ_DEFINE(kmsgq, MSG_SIZE, MSGQ_LEN, 4);
+#endif
 K_MSGQ_DEFINE(kmsgq_test_alloc, MSG_SIZE, MSGQ_LEN, 4);
 struct k_msgq msgq;
 struct k_msgq msgq1;
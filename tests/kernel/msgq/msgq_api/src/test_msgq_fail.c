@@ -9,6 +9,11 @@ static ZTEST_BMEM char __aligned(4) tbuffer[MSG_SIZE * MSGQ_LEN];
 static ZTEST_DMEM uint32_t data[MSGQ_LEN] = { MSG0, MSG1 };
 extern struct k_msgq msgq;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+K_MSGQ_LOCKFREE_DEFINE(kmsgq_ring, MSG_SIZE, MSGQ_LEN, 4);
+K_MSGQ_DEFINE(kmsgq_locked, MSG_SIZE, MSGQ_LEN, 4);
+#endif
+
 static void put_fail(struct k_msgq *q)
 {
 	int ret = k_msgq_put(q, (void *)&data[0], K_NO_WAIT);
@@ -96,6 +101,43 @@ ZTEST_USER(msgq_api, test_msgq_user_get_fail)
 }
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+/**
+ * @brief Test that put_front is only refused by lock-free ring queues
+ * @see k_msgq_put_front(), K_MSGQ_LOCKFREE_DEFINE(), k_msgq_init()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_put_front_ring_fail)
+{
+	uint32_t rx_data;
+
+	/**TESTPOINT: msgq put_front on a ring returns -ENOTSUP*/
+	zassert_equal(k_msgq_put_front(&kmsgq_ring, &data[0]), -ENOTSUP);
+	zassert_equal(k_msgq_num_used_get(&kmsgq_ring), 0);
+
+	/**TESTPOINT: the ring still accepts messages at its back*/
+	zassert_false(k_msgq_put(&kmsgq_ring, &data[0], K_NO_WAIT));
+	zassert_equal(k_msgq_put_front(&kmsgq_ring, &data[1]), -ENOTSUP);
+	zassert_false(k_msgq_get(&kmsgq_ring, &rx_data, K_NO_WAIT));
+	zassert_equal(rx_data, data[0]);
+
+	/**TESTPOINT: queues defined with K_MSGQ_DEFINE() are not rings*/
+	zassert_false(k_msgq_put(&kmsgq_locked, &data[0], K_NO_WAIT));
+	zassert_false(k_msgq_put_front(&kmsgq_locked, &data[1]));
+	zassert_false(k_msgq_get(&kmsgq_locked, &rx_data, K_NO_WAIT));
+	zassert_equal(rx_data, data[1]);
+	k_msgq_purge(&kmsgq_locked);
+
+	/**TESTPOINT: queues initialized with k_msgq_init() are not rings*/
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MSGQ_LEN);
+	zassert_false(k_msgq_put(&msgq, &data[0], K_NO_WAIT));
+	zassert_false(k_msgq_put_front(&msgq, &data[1]));
+	zassert_false(k_msgq_get(&msgq, &rx_data, K_NO_WAIT));
+	zassert_equal(rx_data, data[1]);
+
+	k_msgq_purge(&msgq);
+}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 /**
  * @}
  */
@@ -64,6 +64,11 @@ ZTEST_BMEM SYS_MUTEX_DEFINE(mutex_4);
 
 #ifdef CONFIG_USERSPACE
 static SYS_MUTEX_DEFINE(no_access_mutex);
+static ZTEST_BMEM SYS_MUTEX_DEFINE(forged_owner_mutex);
+
+/* Never granted to the test thread */
+static K_THREAD_STACK_DEFINE(no_access_stack, STACKSIZE);
+static struct k_thread no_access_thread;
 #endif
 static ZTEST_BMEM SYS_MUTEX_DEFINE(not_my_mutex);
 static ZTEST_BMEM SYS_MUTEX_DEFINE(bad_count_mutex);
@@ -470,15 +475,57 @@ ZTEST_USER_OR_NOT(mutex_complex, test_user_access)
 #ifdef CONFIG_USERSPACE
 	int rv;
 
-	rv = sys_mutex_lock(&no_access_mutex, K_NO_WAIT);
-	zassert_true(rv == -EACCES, "accessed mutex not in memory domain");
-	rv = sys_mutex_unlock(&no_access_mutex);
-	zassert_true(rv == -EACCES, "accessed mutex not in memory domain");
+	if (!IS_ENABLED(CONFIG_CURRENT_THREAD_USE_TLS)) {
+		rv = sys_mutex_lock(&no_access_mutex, K_NO_WAIT);
+		zassert_true(rv == -EACCES, "accessed mutex not in memory domain");
+		rv = sys_mutex_unlock(&no_access_mutex);
+		zassert_true(rv == -EACCES, "accessed mutex not in memory domain");
+		return;
+	}
+
+	/* Uncontended mutexes are locked in user mode, straight in the
+	 * mutex memory
+	 */
+	ztest_set_fault_valid(true);
+	(void)sys_mutex_lock(&no_access_mutex, K_NO_WAIT);
+	zassert_unreachable("accessed mutex not in memory domain");
+#else
+	ztest_test_skip();
+#endif /* CONFIG_USERSPACE */
+}
+
+ZTEST_USER_OR_NOT(mutex_complex, test_user_forged_owner)
+{
+#ifdef CONFIG_USERSPACE
+	int rv;
+
+	if (!k_is_user_context()) {
+		ztest_test_skip();
+	}
+
+	/* The owner is read from user memory, a user thread must not be
+	 * able to get a thread it has no access to boosted by waiting
+	 */
+	atomic_set(&forged_owner_mutex.val, (atomic_val_t)&no_access_thread);
+	rv = sys_mutex_lock(&forged_owner_mutex, K_MSEC(100));
+	zassert_true(rv == -EPERM, "waited for a thread without access");
+	zassert_true(atomic_get(&forged_owner_mutex.val) ==
+		     (atomic_val_t)&no_access_thread, "mutex value changed");
+	atomic_set(&forged_owner_mutex.val, 0);
 #else
 	ztest_test_skip();
 #endif /* CONFIG_USERSPACE */
 }
 
+#ifdef CONFIG_USERSPACE
+static void no_access_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+}
+#endif /* CONFIG_USERSPACE */
+
 /*test case main entry*/
 static void *sys_mutex_tests_setup(void)
 {
@@ -497,6 +544,11 @@ static void *sys_mutex_tests_setup(void)
 				&thread_09_thread_data, &thread_09_stack_area,
 				&thread_11_thread_data, &thread_11_stack_area,
 				&thread_12_thread_data, &thread_12_stack_area);
+
+	/* Only initialized, to be forged as the owner of a mutex */
+	k_thread_create(&no_access_thread, no_access_stack, STACKSIZE,
+			no_access_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_FOREVER);
 #endif
 	rv = sys_mutex_lock(&not_my_mutex, K_NO_WAIT);
 	if (rv != 0) {
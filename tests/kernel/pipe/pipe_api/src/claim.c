@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+ZTEST_SUITE(k_pipe_claim, NULL, NULL, NULL, NULL, NULL);
+
+#define BUFFER_SIZE 16
+static struct k_thread thread;
+static K_THREAD_STACK_DEFINE(stack, 1024);
+static struct k_pipe pipe;
+static uint8_t buffer[BUFFER_SIZE];
+
+static void thread_write(void *arg1, void *arg2, void *arg3)
+{
+	uint8_t data[4] = { 1, 2, 3, 4 };
+
+	zassert_equal(k_pipe_write((struct k_pipe *)arg1, data, sizeof(data), K_NO_WAIT),
+		      sizeof(data), "Failed to write to pipe");
+}
+
+static void thread_read_release(void *arg1, void *arg2, void *arg3)
+{
+	uint8_t *area;
+
+	zassert_true(k_pipe_read_claim((struct k_pipe *)arg1, &area, 4, K_NO_WAIT) > 0,
+		     "Failed to claim data");
+	zassert_ok(k_pipe_read_release((struct k_pipe *)arg1, 4), "Failed to release data");
+}
+
+ZTEST(k_pipe_claim, test_write_claim_commit)
+{
+	uint8_t *area;
+	uint8_t res[4];
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	zassert_equal(k_pipe_write_claim(&pipe, &area, 4, K_NO_WAIT), 4, "Failed to claim space");
+	zassert_true(area >= buffer && area + 4 <= buffer + sizeof(buffer),
+		     "Claimed area is not within the pipe buffer");
+	for (int i = 0; i < 4; i++) {
+		area[i] = i;
+	}
+
+	/* nothing is readable before the commit */
+	zassert_equal(k_pipe_read(&pipe, res, sizeof(res), K_NO_WAIT), -EAGAIN,
+		      "Uncommitted data should not be readable");
+
+	zassert_ok(k_pipe_write_commit(&pipe, 3), "Failed to commit data");
+	zassert_equal(k_pipe_read(&pipe, res, sizeof(res), K_NO_WAIT), 3,
+		      "Only committed data should be readable");
+	for (int i = 0; i < 3; i++) {
+		zassert_equal(res[i], i, "Unexpected data received from pipe");
+	}
+}
+
+ZTEST(k_pipe_claim, test_read_claim_release)
+{
+	uint8_t data[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+	uint8_t *area;
+	uint8_t res;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	zassert_equal(k_pipe_write(&pipe, data, sizeof(data), K_NO_WAIT), sizeof(data),
+		      "Failed to write to pipe");
+
+	zassert_equal(k_pipe_read_claim(&pipe, &area, 4, K_NO_WAIT), 4, "Failed to claim data");
+	zassert_mem_equal(area, data, 4, "Unexpected data claimed from pipe");
+
+	zassert_ok(k_pipe_read_release(&pipe, 2), "Failed to release data");
+	zassert_equal(k_pipe_read(&pipe, &res, 1, K_NO_WAIT), 1, "Failed to read from pipe");
+	zassert_equal(res, 2, "Unreleased data should be read again");
+}
+
+ZTEST(k_pipe_claim, test_claim_wrap)
+{
+	uint8_t data[BUFFER_SIZE] = {};
+	uint8_t *area;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	zassert_equal(k_pipe_write(&pipe, data, 12, K_NO_WAIT), 12, "Failed to write to pipe");
+	zassert_equal(k_pipe_read(&pipe, data, 8, K_NO_WAIT), 8, "Failed to read from pipe");
+
+	/* 12 bytes are free, but only 4 of them before the end of the buffer */
+	zassert_equal(k_pipe_write_claim(&pipe, &area, 12, K_NO_WAIT), 4,
+		      "Claimed area should stop at the end of the buffer");
+	zassert_ok(k_pipe_write_commit(&pipe, 4), "Failed to commit data");
+	zassert_equal(k_pipe_write_claim(&pipe, &area, 12, K_NO_WAIT), 8,
+		      "Claimed area should restart at the beginning of the buffer");
+	zassert_equal(area, buffer, "Claimed area should restart at the beginning of the buffer");
+	zassert_ok(k_pipe_write_commit(&pipe, 8), "Failed to commit data");
+}
+
+ZTEST(k_pipe_claim, test_claim_exclusive)
+{
+	uint8_t data[4] = {};
+	uint8_t *area;
+	uint8_t *other;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	zassert_equal(k_pipe_write_commit(&pipe, 0), -EINVAL,
+		      "Commit without a claim should fail");
+	zassert_equal(k_pipe_read_release(&pipe, 0), -EINVAL,
+		      "Release without a claim should fail");
+	zassert_equal(k_pipe_write_claim(&pipe, &area, 0, K_NO_WAIT), -EINVAL,
+		      "Empty claim should fail");
+
+	zassert_equal(k_pipe_write_claim(&pipe, &area, 4, K_NO_WAIT), 4, "Failed to claim space");
+	zassert_equal(k_pipe_write_claim(&pipe, &other, 4, K_NO_WAIT), -EAGAIN,
+		      "Second write claim should wait for the commit");
+	zassert_equal(k_pipe_write(&pipe, data, sizeof(data), K_NO_WAIT), -EAGAIN,
+		      "Write should wait for the commit");
+	zassert_equal(k_pipe_write_commit(&pipe, 5), -EINVAL,
+		      "Commit larger than the claim should fail");
+	zassert_ok(k_pipe_write_commit(&pipe, 4), "Failed to commit data");
+
+	zassert_equal(k_pipe_read_claim(&pipe, &area, 2, K_NO_WAIT), 2, "Failed to claim data");
+	zassert_equal(k_pipe_read(&pipe, data, sizeof(data), K_NO_WAIT), -EAGAIN,
+		      "Read should wait for the release");
+	zassert_ok(k_pipe_read_release(&pipe, 2), "Failed to release data");
+	zassert_equal(k_pipe_read(&pipe, data, sizeof(data), K_NO_WAIT), 2,
+		      "Failed to read from pipe");
+}
+
+ZTEST(k_pipe_claim, test_read_claim_wait)
+{
+	k_tid_t tid;
+	uint8_t *area;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	tid = k_thread_create(&thread, stack, K_THREAD_STACK_SIZEOF(stack),
+		thread_write, &pipe, NULL, NULL, K_PRIO_COOP(0), 0, K_MSEC(100));
+	zassert_equal(k_pipe_read_claim(&pipe, &area, 8, K_MSEC(1000)), 4,
+		      "Failed to claim data written while waiting");
+	zassert_equal(area[3], 4, "Unexpected data claimed from pipe");
+	zassert_ok(k_pipe_read_release(&pipe, 4), "Failed to release data");
+	k_thread_join(tid, K_FOREVER);
+
+	zassert_equal(k_pipe_read_claim(&pipe, &area, 8, K_MSEC(100)), -EAGAIN,
+		      "Claim on an empty pipe should time out");
+}
+
+ZTEST(k_pipe_claim, test_write_claim_wait)
+{
+	k_tid_t tid;
+	uint8_t data[BUFFER_SIZE] = {};
+	uint8_t *area;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	zassert_equal(k_pipe_write(&pipe, data, sizeof(data), K_NO_WAIT), sizeof(data),
+		      "Failed to fill the pipe");
+
+	tid = k_thread_create(&thread, stack, K_THREAD_STACK_SIZEOF(stack),
+		thread_read_release, &pipe, NULL, NULL, K_PRIO_COOP(0), 0, K_MSEC(100));
+	zassert_equal(k_pipe_write_claim(&pipe, &area, 8, K_MSEC(1000)), 4,
+		      "Failed to claim space released while waiting");
+	zassert_ok(k_pipe_write_commit(&pipe, 4), "Failed to commit data");
+	k_thread_join(tid, K_FOREVER);
+}
+
+ZTEST(k_pipe_claim, test_claim_reset_close)
+{
+	uint8_t data[4] = {};
+	uint8_t *area;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	zassert_equal(k_pipe_write_claim(&pipe, &area, 4, K_NO_WAIT), 4, "Failed to claim space");
+	k_pipe_reset(&pipe);
+	zassert_equal(k_pipe_write_commit(&pipe, 4), -EINVAL,
+		      "Reset should cancel the write claim");
+
+	zassert_equal(k_pipe_write(&pipe, data, sizeof(data), K_NO_WAIT), sizeof(data),
+		      "Failed to write to pipe");
+	zassert_equal(k_pipe_write_claim(&pipe, &area, 4, K_NO_WAIT), 4, "Failed to claim space");
+	k_pipe_close(&pipe);
+	zassert_equal(k_pipe_write_commit(&pipe, 4), -EPIPE,
+		      "Commit on a closed pipe should fail");
+
+	/* data written before closing the pipe can still be claimed */
+	zassert_equal(k_pipe_read_claim(&pipe, &area, 8, K_NO_WAIT), sizeof(data),
+		      "Failed to claim data from a closed pipe");
+	zassert_ok(k_pipe_read_release(&pipe, sizeof(data)), "Failed to release data");
+	zassert_equal(k_pipe_read_claim(&pipe, &area, 8, K_NO_WAIT), -EPIPE,
+		      "Claim on a closed empty pipe should fail");
+	zassert_equal(k_pipe_write_claim(&pipe, &area, 4, K_NO_WAIT), -EPIPE,
+		      "Claim on a closed pipe should fail");
+}
+
+#ifdef CONFIG_POLL
+ZTEST(k_pipe_claim, test_commit_poll)
+{
+	struct k_poll_event event;
+	uint8_t *area;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	k_poll_event_init(&event, K_POLL_TYPE_PIPE_DATA_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY,
+			  &pipe);
+
+	zassert_equal(k_pipe_write_claim(&pipe, &area, 4, K_NO_WAIT), 4, "Failed to claim space");
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN,
+		      "Uncommitted data should not be signalled");
+	zassert_ok(k_pipe_write_commit(&pipe, 4), "Failed to commit data");
+	zassert_ok(k_poll(&event, 1, K_NO_WAIT), "Committed data should be signalled");
+	zassert_equal(event.state, K_POLL_STATE_PIPE_DATA_AVAILABLE, "Unexpected poll state");
+}
+#endif /* CONFIG_POLL */
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#define NUM_SEMS   8
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static struct k_poll_set set;
+static struct k_sem sems[NUM_SEMS];
+static struct k_poll_event sem_events[NUM_SEMS];
+static struct k_poll_signal set_signal;
+static struct k_poll_event signal_event;
+
+static K_THREAD_STACK_DEFINE(set_stack, STACK_SIZE);
+static struct k_thread set_thread;
+
+static void set_prepare(void)
+{
+	k_poll_set_init(&set);
+
+	for (int i = 0; i < NUM_SEMS; i++) {
+		k_sem_init(&sems[i], 0, 1);
+		k_poll_event_init(&sem_events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &sems[i]);
+		sem_events[i].tag = i;
+		zassert_ok(k_poll_set_add(&set, &sem_events[i]));
+	}
+}
+
+static void set_cleanup(void)
+{
+	for (int i = 0; i < NUM_SEMS; i++) {
+		zassert_ok(k_poll_set_remove(&set, &sem_events[i]));
+	}
+}
+
+/**
+ * @brief Test that a poll set only returns the events that are ready
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_init(), k_poll_set_add(), k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_ready)
+{
+	struct k_poll_event *ready[NUM_SEMS];
+	int num;
+
+	set_prepare();
+
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), -EAGAIN);
+
+	k_sem_give(&sems[5]);
+	k_sem_give(&sems[2]);
+
+	/* Events come in the order they became ready */
+	num = k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT);
+	zassert_equal(num, 2);
+	zassert_equal(ready[0], &sem_events[5]);
+	zassert_equal(ready[1], &sem_events[2]);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SEM_AVAILABLE);
+
+	/* Consumed events are not returned again */
+	zassert_ok(k_sem_take(&sems[5], K_NO_WAIT));
+	zassert_ok(k_sem_take(&sems[2], K_NO_WAIT));
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), -EAGAIN);
+
+	/* Registrations survive across waits */
+	k_sem_give(&sems[2]);
+	num = k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT);
+	zassert_equal(num, 1);
+	zassert_equal(ready[0], &sem_events[2]);
+
+	set_cleanup();
+}
+
+/**
+ * @brief Test that poll set events are level-triggered
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_level)
+{
+	struct k_poll_event *all[NUM_SEMS + 1];
+	struct k_poll_event *ready[2];
+
+	set_prepare();
+
+	/* An event added while its object is available is ready at once */
+	k_poll_signal_init(&set_signal);
+	k_poll_signal_raise(&set_signal, 0);
+	k_poll_event_init(&signal_event, K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_signal);
+	zassert_ok(k_poll_set_add(&set, &signal_event));
+	zassert_equal(k_poll_set_add(&set, &signal_event), -EBUSY);
+
+	for (int i = 0; i < NUM_SEMS; i++) {
+		k_sem_give(&sems[i]);
+	}
+
+	/* Ready events not returned yet wait for the next call */
+	zassert_equal(k_poll_set_wait(&set, ready, 2, K_NO_WAIT), 2);
+	zassert_equal(ready[0], &signal_event);
+	zassert_equal(ready[1], &sem_events[0]);
+
+	/* The semaphore is consumed but the signal is not reset, so only
+	 * the latter is reported again.
+	 */
+	zassert_ok(k_sem_take(&sems[0], K_NO_WAIT));
+	zassert_equal(k_poll_set_wait(&set, all, NUM_SEMS + 1, K_NO_WAIT), NUM_SEMS);
+	zassert_equal(all[0], &sem_events[1]);
+	zassert_equal(all[NUM_SEMS - 1], &signal_event);
+
+	k_poll_signal_reset(&set_signal);
+	zassert_ok(k_poll_set_remove(&set, &signal_event));
+	zassert_equal(k_poll_set_remove(&set, &signal_event), -EINVAL);
+
+	for (int i = 1; i < NUM_SEMS; i++) {
+		zassert_ok(k_sem_take(&sems[i], K_NO_WAIT));
+	}
+
+	set_cleanup();
+	zassert_equal(k_poll_set_wait(&set, ready, 2, K_NO_WAIT), -EAGAIN);
+}
+
+static void set_giver_entry(void *p1, void *p2, void *p3)
+{
+	k_msleep(10);
+	k_sem_give(&sems[NUM_SEMS - 1]);
+}
+
+/**
+ * @brief Test that a thread waiting on a poll set is woken by its events
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_wait)
+{
+	struct k_poll_event *ready[NUM_SEMS];
+
+	set_prepare();
+
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_MSEC(10)), -EAGAIN);
+
+	k_thread_create(&set_thread, set_stack, STACK_SIZE, set_giver_entry,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_FOREVER), 1);
+	zassert_equal(ready[0], &sem_events[NUM_SEMS - 1]);
+	zassert_equal(ready[0]->tag, NUM_SEMS - 1);
+
+	k_thread_join(&set_thread, K_FOREVER);
+	zassert_ok(k_sem_take(&sems[NUM_SEMS - 1], K_NO_WAIT));
+
+	set_cleanup();
+}
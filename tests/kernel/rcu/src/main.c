@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/rcu.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define PRIO_LOW   K_PRIO_PREEMPT(5)
+#define PRIO_MID   K_PRIO_PREEMPT(4)
+#define PRIO_HIGH  K_PRIO_PREEMPT(2)
+
+struct item {
+	sys_snode_t node;
+	int value;
+};
+
+static K_THREAD_STACK_DEFINE(reader_stack, STACK_SIZE);
+static struct k_thread reader_thread;
+static K_THREAD_STACK_DEFINE(sync_stack, STACK_SIZE);
+static struct k_thread sync_thread;
+
+static K_SEM_DEFINE(reader_sem, 0, 1);
+
+static volatile bool reader_done;
+static volatile bool synchronized;
+static volatile bool reader_done_at_sync;
+static volatile bool called;
+
+/**
+ * @defgroup kernel_rcu_tests RCU
+ * @ingroup all_tests
+ * @{
+ * @}
+ */
+
+/**
+ * @brief Test publishing and unpublishing list nodes to RCU readers
+ *
+ * @ingroup kernel_rcu_tests
+ *
+ * @see k_rcu_slist_prepend(), k_rcu_slist_append(),
+ * k_rcu_slist_find_and_remove(), K_RCU_SLIST_FOR_EACH_CONTAINER()
+ */
+ZTEST(rcu, test_rcu_slist)
+{
+	struct item items[3] = { { .value = 1 }, { .value = 2 }, { .value = 3 } };
+	sys_slist_t list;
+	struct item *item;
+	int sum = 0;
+
+	sys_slist_init(&list);
+
+	for (int i = 0; i < ARRAY_SIZE(items); i++) {
+		k_rcu_slist_prepend(&list, &items[i].node);
+	}
+
+	zassert_equal(sys_slist_peek_tail(&list), &items[0].node);
+
+	zassert_true(k_rcu_slist_find_and_remove(&list, &items[1].node));
+	zassert_false(k_rcu_slist_find_and_remove(&list, &items[1].node));
+
+	/* A reader standing on the removed node goes on */
+	zassert_equal(items[1].node.next, &items[0].node);
+
+	zassert_true(k_rcu_slist_find_and_remove(&list, &items[0].node));
+	zassert_equal(sys_slist_peek_tail(&list), &items[2].node);
+
+	k_rcu_read_lock();
+	K_RCU_SLIST_FOR_EACH_CONTAINER(&list, item, node) {
+		sum += item->value;
+	}
+	k_rcu_read_unlock();
+
+	zassert_equal(sum, 3);
+
+	k_rcu_slist_append(&list, &items[1].node);
+	zassert_equal(sys_slist_peek_tail(&list), &items[1].node);
+	zassert_equal(items[2].node.next, &items[1].node);
+	zassert_is_null(items[1].node.next);
+}
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	k_rcu_read_lock();
+	k_rcu_read_lock();
+
+	/* Switched out inside the critical section */
+	k_sem_take(&reader_sem, K_FOREVER);
+
+	k_rcu_read_unlock();
+	reader_done = true;
+	k_rcu_read_unlock();
+}
+
+static void sync_entry(void *p1, void *p2, void *p3)
+{
+	k_rcu_synchronize();
+
+	reader_done_at_sync = reader_done;
+	synchronized = true;
+}
+
+/**
+ * @brief Test that a grace period waits for the readers in progress
+ *
+ * @ingroup kernel_rcu_tests
+ *
+ * @see k_rcu_read_lock(), k_rcu_read_unlock(), k_rcu_synchronize()
+ */
+ZTEST(rcu, test_rcu_synchronize)
+{
+	k_thread_priority_set(k_current_get(), PRIO_LOW);
+
+	/* Nobody is reading */
+	k_rcu_synchronize();
+
+	k_thread_create(&reader_thread, reader_stack, STACK_SIZE, reader_entry,
+			NULL, NULL, NULL, PRIO_HIGH, 0, K_NO_WAIT);
+	k_thread_create(&sync_thread, sync_stack, STACK_SIZE, sync_entry,
+			NULL, NULL, NULL, PRIO_MID, 0, K_NO_WAIT);
+
+	k_sleep(K_MSEC(50));
+	zassert_false(synchronized);
+
+	k_sem_give(&reader_sem);
+
+	k_thread_join(&sync_thread, K_FOREVER);
+	k_thread_join(&reader_thread, K_FOREVER);
+
+	zassert_true(synchronized);
+	zassert_true(reader_done_at_sync);
+}
+
+static void rcu_cb(struct k_rcu_head *head)
+{
+	ARG_UNUSED(head);
+
+	called = true;
+}
+
+/**
+ * @brief Test that callbacks run after the readers in progress are done
+ *
+ * @ingroup kernel_rcu_tests
+ *
+ * @see k_rcu_call()
+ */
+ZTEST(rcu, test_rcu_call)
+{
+	static struct k_rcu_head head;
+
+	k_rcu_read_lock();
+
+	k_rcu_call(&head, rcu_cb);
+
+	k_sleep(K_MSEC(50));
+	zassert_false(called);
+
+	k_rcu_read_unlock();
+
+	k_sleep(K_MSEC(50));
+	zassert_true(called);
+}
+
+static void rcu_tests_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	reader_done = false;
+	synchronized = false;
+	reader_done_at_sync = false;
+	called = false;
+}
+
+ZTEST_SUITE(rcu, NULL, NULL, rcu_tests_before, NULL, NULL);
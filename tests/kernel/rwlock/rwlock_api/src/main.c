@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define PRIO_LOW   K_PRIO_PREEMPT(5)
+#define PRIO_HIGH  K_PRIO_PREEMPT(2)
+
+/**TESTPOINT: init via K_RWLOCK_DEFINE*/
+K_RWLOCK_DEFINE(krwlock);
+static struct k_rwlock trwlock;
+
+static K_THREAD_STACK_DEFINE(tstack, STACK_SIZE);
+static struct k_thread tdata;
+
+static ZTEST_BMEM volatile bool helper_locked;
+
+/**
+ * @defgroup kernel_rwlock_tests Reader-writer locks
+ * @ingroup all_tests
+ * @{
+ * @}
+ */
+
+/**
+ * @brief Test that readers share the lock and writers exclude everybody
+ *
+ * @ingroup kernel_rwlock_tests
+ *
+ * @see k_rwlock_init(), k_rwlock_read_lock(), k_rwlock_read_unlock(),
+ * k_rwlock_write_lock(), k_rwlock_write_unlock()
+ */
+ZTEST_USER(rwlock_api, test_rwlock_read_write)
+{
+	zassert_ok(k_rwlock_init(&trwlock));
+
+	zassert_ok(k_rwlock_read_lock(&trwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_lock(&trwlock, K_FOREVER));
+	zassert_equal(k_rwlock_write_lock(&trwlock, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_rwlock_write_lock(&trwlock, K_MSEC(10)), -EAGAIN);
+	zassert_equal(k_rwlock_write_unlock(&trwlock), -EPERM);
+	zassert_ok(k_rwlock_read_unlock(&trwlock));
+	zassert_ok(k_rwlock_read_unlock(&trwlock));
+	zassert_equal(k_rwlock_read_unlock(&trwlock), -EINVAL);
+
+	zassert_ok(k_rwlock_write_lock(&krwlock, K_NO_WAIT));
+	zassert_equal(k_rwlock_read_lock(&krwlock, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_rwlock_read_unlock(&krwlock), -EINVAL);
+	zassert_ok(k_rwlock_write_unlock(&krwlock));
+	zassert_equal(k_rwlock_write_unlock(&krwlock), -EPERM);
+
+	zassert_ok(k_rwlock_read_lock(&krwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_unlock(&krwlock));
+}
+
+static void writer_entry(void *p1, void *p2, void *p3)
+{
+	struct k_rwlock *rwlock = p1;
+
+	zassert_ok(k_rwlock_write_lock(rwlock, K_FOREVER));
+	helper_locked = true;
+	zassert_ok(k_rwlock_write_unlock(rwlock));
+}
+
+/**
+ * @brief Test that a waiting writer goes before new readers
+ *
+ * @ingroup kernel_rwlock_tests
+ *
+ * @see k_rwlock_read_lock(), k_rwlock_write_lock()
+ */
+ZTEST(rwlock_api, test_rwlock_writer_preference)
+{
+	k_thread_priority_set(k_current_get(), PRIO_LOW);
+	zassert_ok(k_rwlock_init(&trwlock));
+	zassert_ok(k_rwlock_read_lock(&trwlock, K_FOREVER));
+
+	/* The writer preempts this thread and waits for the reader */
+	k_thread_create(&tdata, tstack, STACK_SIZE, writer_entry, &trwlock,
+			NULL, NULL, PRIO_HIGH, 0, K_NO_WAIT);
+	zassert_false(helper_locked);
+
+	zassert_equal(k_rwlock_read_lock(&trwlock, K_NO_WAIT), -EBUSY);
+
+	/* The last reader hands the lock over to the writer */
+	zassert_ok(k_rwlock_read_unlock(&trwlock));
+	zassert_true(helper_locked);
+
+	k_thread_join(&tdata, K_FOREVER);
+
+	zassert_ok(k_rwlock_read_lock(&trwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_unlock(&trwlock));
+}
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	struct k_rwlock *rwlock = p1;
+	k_timeout_t timeout = *(k_timeout_t *)p2;
+
+	if (k_rwlock_read_lock(rwlock, timeout) == 0) {
+		helper_locked = true;
+		zassert_ok(k_rwlock_read_unlock(rwlock));
+	}
+}
+
+/**
+ * @brief Test that the writer inherits the priority of waiting threads
+ *
+ * @ingroup kernel_rwlock_tests
+ *
+ * @see k_rwlock_write_lock(), k_rwlock_write_unlock()
+ */
+ZTEST(rwlock_api, test_rwlock_prio_inheritance)
+{
+	static k_timeout_t forever = K_FOREVER;
+
+	k_thread_priority_set(k_current_get(), PRIO_LOW);
+	zassert_ok(k_rwlock_init(&trwlock));
+	zassert_ok(k_rwlock_write_lock(&trwlock, K_FOREVER));
+
+	k_thread_create(&tdata, tstack, STACK_SIZE, reader_entry, &trwlock,
+			&forever, NULL, PRIO_HIGH, 0, K_NO_WAIT);
+	zassert_false(helper_locked);
+	zassert_equal(k_thread_priority_get(k_current_get()), PRIO_HIGH);
+
+	/* Unlocking gives the priority back and lets the reader in */
+	zassert_ok(k_rwlock_write_unlock(&trwlock));
+	zassert_equal(k_thread_priority_get(k_current_get()), PRIO_LOW);
+	zassert_true(helper_locked);
+
+	k_thread_join(&tdata, K_FOREVER);
+}
+
+/**
+ * @brief Test that a thread giving up waiting takes its priority back
+ *
+ * @ingroup kernel_rwlock_tests
+ *
+ * @see k_rwlock_read_lock()
+ */
+ZTEST(rwlock_api, test_rwlock_timeout)
+{
+	static k_timeout_t timeout = K_MSEC(10);
+
+	k_thread_priority_set(k_current_get(), PRIO_LOW);
+	zassert_ok(k_rwlock_init(&trwlock));
+	zassert_ok(k_rwlock_write_lock(&trwlock, K_FOREVER));
+
+	k_thread_create(&tdata, tstack, STACK_SIZE, reader_entry, &trwlock,
+			&timeout, NULL, PRIO_HIGH, 0, K_NO_WAIT);
+	zassert_equal(k_thread_priority_get(k_current_get()), PRIO_HIGH);
+
+	k_thread_join(&tdata, K_FOREVER);
+	zassert_false(helper_locked);
+	zassert_equal(k_thread_priority_get(k_current_get()), PRIO_LOW);
+
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	struct k_rwlock_stats stats;
+
+	zassert_ok(k_obj_core_stats_raw(K_OBJ_CORE(&trwlock), &stats, sizeof(stats)));
+	zassert_equal(stats.read_waits, 1);
+	zassert_equal(stats.write_waits, 0);
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+
+	zassert_ok(k_rwlock_write_unlock(&trwlock));
+}
+
+static void *rwlock_api_tests_setup(void)
+{
+#ifdef CONFIG_USERSPACE
+	k_thread_access_grant(k_current_get(), &krwlock, &trwlock);
+#endif
+	return NULL;
+}
+
+static void rwlock_api_tests_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	helper_locked = false;
+}
+
+ZTEST_SUITE(rwlock_api, NULL, rwlock_api_tests_setup, rwlock_api_tests_before,
+	    NULL, NULL);
@@ -38,4 +38,28 @@ ZTEST(wraparound, test_tick_wraparound_in_sleep)
 	k_timer_stop(&alarm);
 }
 
+K_TIMER_DEFINE(pending, NULL, NULL);
+
+/**
+ * @brief Test that setting the tick count keeps the time left to timeouts
+ */
+ZTEST(wraparound, test_tick_set_keeps_pending_timeouts)
+{
+	static const uint32_t timeout_ticks = 300;
+	k_ticks_t before;
+	k_ticks_t after;
+
+	k_timer_start(&pending, K_TICKS(timeout_ticks), K_NO_WAIT);
+
+	before = k_timer_remaining_ticks(&pending);
+	sys_clock_tick_set(sys_clock_tick_get() + 0x10000);
+	after = k_timer_remaining_ticks(&pending);
+
+	zassert_true((after <= before) && (before - after <= 1),
+		     "time left moved from %lld to %lld ticks",
+		     (long long)before, (long long)after);
+
+	k_timer_stop(&pending);
+}
+
 ZTEST_SUITE(wraparound, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define NUM_TIMERS 4
+#define FIRST_MS   10
+#define STRIDE_MS  2
+#define SLACK_MS   20
+
+static struct k_timer timers[NUM_TIMERS];
+
+static struct k_timer_stats timer_stats(struct k_timer *timer)
+{
+	struct k_timer_stats stats;
+
+	zassert_ok(k_obj_core_stats_raw(K_OBJ_CORE(timer), &stats, sizeof(stats)));
+
+	return stats;
+}
+
+/* Start timers expiring STRIDE_MS apart and wait for all of them */
+static uint32_t run_timers(k_timeout_t slack)
+{
+	uint32_t merged = 0U;
+
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		k_timer_start(&timers[i],
+			      K_TIMEOUT_SLACK(K_MSEC(FIRST_MS + i * STRIDE_MS), slack),
+			      K_NO_WAIT);
+	}
+
+	k_msleep(FIRST_MS + NUM_TIMERS * STRIDE_MS + 2 * SLACK_MS);
+
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		struct k_timer_stats stats = timer_stats(&timers[i]);
+
+		zassert_equal(k_timer_status_get(&timers[i]), 1);
+		zassert_equal(stats.expirations, 1);
+		merged += stats.merged;
+	}
+
+	return merged;
+}
+
+/* A timeout with slack expires within its window */
+ZTEST(timer_slack, test_window)
+{
+	int64_t start = k_uptime_ticks();
+	int64_t elapsed;
+
+	k_timer_start(&timers[0], K_TIMEOUT_SLACK(K_MSEC(FIRST_MS), K_MSEC(SLACK_MS)),
+		      K_NO_WAIT);
+	zassert_equal(k_timer_status_sync(&timers[0]), 1);
+	elapsed = k_uptime_ticks() - start;
+
+	zassert_true(elapsed >= k_ms_to_ticks_floor64(FIRST_MS),
+		     "expired early after %lld ticks", elapsed);
+	zassert_true(elapsed <= k_ms_to_ticks_ceil64(FIRST_MS + SLACK_MS) + 2,
+		     "expired late after %lld ticks", elapsed);
+}
+
+/* Timeouts within the slack of each other expire in a single wakeup */
+ZTEST(timer_slack, test_merged)
+{
+	if (!IS_ENABLED(CONFIG_TICKLESS_KERNEL)) {
+		ztest_test_skip();
+	}
+
+	zassert_equal(run_timers(K_MSEC(SLACK_MS)), NUM_TIMERS - 1);
+}
+
+/* Timeouts without slack keep expiring on their own tick */
+ZTEST(timer_slack, test_no_slack)
+{
+	zassert_equal(run_timers(K_NO_WAIT), 0);
+}
+
+/* Timeouts with slack program the system timer less often */
+ZTEST(timer_slack, test_timeout_stats)
+{
+	struct sys_clock_timeout_stats with_slack;
+	struct sys_clock_timeout_stats without_slack;
+
+	if (!IS_ENABLED(CONFIG_TICKLESS_KERNEL)) {
+		ztest_test_skip();
+	}
+
+	sys_clock_timeout_stats_reset();
+	run_timers(K_MSEC(SLACK_MS));
+	sys_clock_timeout_stats_get(&with_slack);
+
+	sys_clock_timeout_stats_reset();
+	run_timers(K_NO_WAIT);
+	sys_clock_timeout_stats_get(&without_slack);
+
+	TC_PRINT("with slack: %u reprograms, %u coalesced\n",
+		 with_slack.reprograms, with_slack.coalesced);
+	TC_PRINT("without slack: %u reprograms, %u coalesced\n",
+		 without_slack.reprograms, without_slack.coalesced);
+
+	zassert_equal(with_slack.coalesced, NUM_TIMERS - 1);
+	zassert_equal(without_slack.coalesced, 0);
+	zassert_true(with_slack.reprograms < without_slack.reprograms,
+		     "%u reprograms with slack, %u without",
+		     with_slack.reprograms, without_slack.reprograms);
+}
+
+static void *timer_slack_setup(void)
+{
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		k_timer_init(&timers[i], NULL, NULL);
+	}
+
+	return NULL;
+}
+
+static void timer_slack_before(void *fixture)
+{
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		zassert_ok(k_obj_core_stats_reset(K_OBJ_CORE(&timers[i])));
+	}
+}
+
+ZTEST_SUITE(timer_slack, NULL, timer_slack_setup, timer_slack_before, NULL, NULL);
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_WAKEUPS 10
+#define BUSY_US     20000
+#define SLEEP_MS    5
+
+static K_THREAD_STACK_DEFINE(helper_stack, STACK_SIZE);
+static struct k_thread helper_thread;
+
+static K_SEM_DEFINE(wakeup_sem, 0, NUM_WAKEUPS);
+
+static uint32_t hist_sum(const k_thread_runtime_stats_t *stats)
+{
+	uint32_t sum = 0U;
+
+	for (int i = 0; i < CONFIG_SCHED_THREAD_LATENCY_BUCKETS; i++) {
+		sum += stats->latency_hist[i];
+	}
+
+	return sum;
+}
+
+static void waiter_entry(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < NUM_WAKEUPS; i++) {
+		k_sem_take(&wakeup_sem, K_FOREVER);
+	}
+}
+
+static void spinner_entry(void *p1, void *p2, void *p3)
+{
+	k_busy_wait(BUSY_US);
+}
+
+/* Every wakeup of a thread lands in its histogram */
+ZTEST(thread_latency, test_wakeup_histogram)
+{
+	k_thread_runtime_stats_t stats;
+	int prio = k_thread_priority_get(k_current_get());
+
+	/* The higher priority waiter runs as soon as it is started or woken */
+	k_thread_create(&helper_thread, helper_stack, STACK_SIZE, waiter_entry,
+			NULL, NULL, NULL, prio - 1, 0, K_NO_WAIT);
+
+	for (int i = 0; i < NUM_WAKEUPS; i++) {
+		k_sem_give(&wakeup_sem);
+	}
+
+	zassert_ok(k_thread_join(&helper_thread, K_FOREVER));
+	zassert_ok(k_thread_runtime_stats_get(&helper_thread, &stats));
+
+	zassert_equal(hist_sum(&stats), NUM_WAKEUPS + 1);
+	zassert_equal(stats.preemptions, 0);
+}
+
+/* A thread switched out while still ready is counted as preempted */
+ZTEST(thread_latency, test_preemption)
+{
+	k_thread_runtime_stats_t stats;
+	int prio = k_thread_priority_get(k_current_get());
+
+	/* The lower priority spinner only runs while this thread sleeps */
+	k_thread_create(&helper_thread, helper_stack, STACK_SIZE, spinner_entry,
+			NULL, NULL, NULL, prio + 1, 0, K_NO_WAIT);
+
+	k_msleep(SLEEP_MS);
+	zassert_ok(k_thread_runtime_stats_get(&helper_thread, &stats));
+	zassert_equal(stats.preemptions, 1);
+
+	zassert_ok(k_thread_join(&helper_thread, K_FOREVER));
+	zassert_ok(k_thread_runtime_stats_get(&helper_thread, &stats));
+
+	/* Started once, and resumed after the preemption */
+	zassert_equal(stats.preemptions, 1);
+	zassert_equal(hist_sum(&stats), 2);
+	zassert_true(stats.peak_latency_cycles > 0U);
+}
+
+/* CPU statistics carry no latency */
+ZTEST(thread_latency, test_cpu_stats)
+{
+	k_thread_runtime_stats_t stats;
+
+	if (!IS_ENABLED(CONFIG_SCHED_THREAD_USAGE_ALL)) {
+		ztest_test_skip();
+	}
+
+	zassert_ok(k_thread_runtime_stats_cpu_get(0, &stats));
+	zassert_equal(stats.preemptions, 0);
+	zassert_equal(hist_sum(&stats), 0);
+}
+
+ZTEST_SUITE(thread_latency, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define NUM_WORKERS 3
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define POOL_PRIORITY K_PRIO_PREEMPT(1)
+#define WAIT_TIMEOUT K_MSEC(1000)
+#define RELEASE_MS 50
+
+static K_THREAD_STACK_ARRAY_DEFINE(pool_stacks, NUM_WORKERS, STACK_SIZE);
+static struct k_work_q_worker pool_workers[NUM_WORKERS];
+static struct k_work_q pool;
+
+static struct k_sem release_sem;
+static struct k_sem done_sem;
+static struct k_timer release_timer;
+
+static atomic_t active;
+static atomic_t max_active;
+static atomic_t runs;
+static k_tid_t blocker_tid;
+static k_tid_t stolen_tid;
+
+static struct k_work blocker_work[NUM_WORKERS];
+static struct k_work counter_work;
+static struct k_work reentry_work;
+static struct k_work chain_work;
+static struct k_work stolen_work;
+static struct k_work slow_work;
+static struct k_work_delayable delayed_work;
+
+/* Block until the test releases the worker */
+static void blocker_handler(struct k_work *work)
+{
+	blocker_tid = k_current_get();
+	k_sem_give(&done_sem);
+	k_sem_take(&release_sem, K_FOREVER);
+}
+
+static void counter_handler(struct k_work *work)
+{
+	atomic_inc(&runs);
+	k_sem_give(&done_sem);
+}
+
+/* Track how many workers run the item at the same time */
+static void reentry_handler(struct k_work *work)
+{
+	atomic_val_t now = atomic_inc(&active) + 1;
+	atomic_val_t max = atomic_get(&max_active);
+
+	while ((now > max) && !atomic_cas(&max_active, max, now)) {
+		max = atomic_get(&max_active);
+	}
+
+	k_msleep(5);
+	atomic_inc(&runs);
+	atomic_dec(&active);
+
+	if (atomic_get(&runs) < 4) {
+		(void)k_work_submit_to_queue(&pool, work);
+	}
+}
+
+/* Chain an item to the pool, then block */
+static void chain_handler(struct k_work *work)
+{
+	blocker_tid = k_current_get();
+	(void)k_work_submit_to_queue(&pool, &stolen_work);
+	k_sem_take(&release_sem, K_FOREVER);
+}
+
+static void stolen_handler(struct k_work *work)
+{
+	stolen_tid = k_current_get();
+	k_sem_give(&done_sem);
+}
+
+static void slow_handler(struct k_work *work)
+{
+	k_msleep(20);
+	atomic_inc(&runs);
+}
+
+static void release_cb(struct k_timer *timer)
+{
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_sem_give(&release_sem);
+	}
+}
+
+static void release_later(void)
+{
+	k_timer_start(&release_timer, K_MSEC(RELEASE_MS), K_NO_WAIT);
+}
+
+/* Submit a blocker and wait until a worker runs it */
+static void start_blocker(int i)
+{
+	zassert_equal(k_work_submit_to_queue(&pool, &blocker_work[i]), 1);
+	zassert_ok(k_sem_take(&done_sem, WAIT_TIMEOUT));
+}
+
+ZTEST(work_pool, test_start)
+{
+	zassert_equal(pool.flags, K_WORK_QUEUE_STARTED);
+	zassert_equal(k_work_queue_thread_get(&pool), &pool_workers[0].thread);
+
+	if (IS_ENABLED(CONFIG_THREAD_NAME)) {
+		for (int i = 0; i < NUM_WORKERS; i++) {
+			zassert_str_equal(k_thread_name_get(&pool_workers[i].thread),
+					  "wq.pool");
+		}
+	}
+}
+
+/* A handler that blocks does not hold up the items behind it */
+ZTEST(work_pool, test_slow_item)
+{
+	start_blocker(0);
+
+	zassert_equal(k_work_submit_to_queue(&pool, &counter_work), 1);
+	zassert_ok(k_sem_take(&done_sem, WAIT_TIMEOUT));
+	zassert_equal(atomic_get(&runs), 1);
+	zassert_equal(k_work_busy_get(&blocker_work[0]), K_WORK_RUNNING);
+
+	k_sem_give(&release_sem);
+}
+
+/* An item never runs on two workers at the same time */
+ZTEST(work_pool, test_no_reentry)
+{
+	struct k_work_sync sync;
+
+	zassert_equal(k_work_submit_to_queue(&pool, &reentry_work), 1);
+
+	for (int i = 0; i < 10; i++) {
+		(void)k_work_submit_to_queue(&pool, &reentry_work);
+		k_msleep(1);
+	}
+
+	do {
+		(void)k_work_flush(&reentry_work, &sync);
+	} while (k_work_is_pending(&reentry_work));
+
+	zassert_true(atomic_get(&runs) >= 4);
+	zassert_equal(atomic_get(&max_active), 1);
+}
+
+/* An item chained by a busy worker is stolen by an idle one */
+ZTEST(work_pool, test_steal)
+{
+	zassert_equal(k_work_submit_to_queue(&pool, &chain_work), 1);
+	zassert_ok(k_sem_take(&done_sem, WAIT_TIMEOUT));
+	zassert_not_equal(stolen_tid, blocker_tid);
+	zassert_equal(k_work_busy_get(&chain_work), K_WORK_RUNNING);
+
+	k_sem_give(&release_sem);
+}
+
+/* Flushing a running item waits for it */
+ZTEST(work_pool, test_running_flush)
+{
+	struct k_work_sync sync;
+
+	start_blocker(0);
+	release_later();
+
+	zassert_true(k_work_flush(&blocker_work[0], &sync));
+	zassert_false(k_work_is_pending(&blocker_work[0]));
+}
+
+/* Flushing a queued item waits for it, whichever worker runs it */
+ZTEST(work_pool, test_queued_flush)
+{
+	struct k_work_sync sync;
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		start_blocker(i);
+	}
+
+	zassert_equal(k_work_submit_to_queue(&pool, &slow_work), 1);
+	zassert_equal(k_work_busy_get(&slow_work), K_WORK_QUEUED);
+	release_later();
+
+	zassert_true(k_work_flush(&slow_work, &sync));
+	zassert_equal(atomic_get(&runs), 1);
+}
+
+/* Canceling a running item waits for it */
+ZTEST(work_pool, test_running_cancel_sync)
+{
+	struct k_work_sync sync;
+
+	start_blocker(0);
+	release_later();
+
+	zassert_true(k_work_cancel_sync(&blocker_work[0], &sync));
+	zassert_false(k_work_is_pending(&blocker_work[0]));
+}
+
+/* Canceling a queued item removes it */
+ZTEST(work_pool, test_queued_cancel)
+{
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		start_blocker(i);
+	}
+
+	zassert_equal(k_work_submit_to_queue(&pool, &counter_work), 1);
+	zassert_equal(k_work_cancel(&counter_work), 0);
+
+	release_cb(NULL);
+	zassert_equal(k_work_queue_drain(&pool, false), 1);
+	zassert_equal(atomic_get(&runs), 0);
+}
+
+ZTEST(work_pool, test_delayable)
+{
+	struct k_work_sync sync;
+
+	zassert_equal(k_work_schedule_for_queue(&pool, &delayed_work, K_MSEC(10)), 1);
+	zassert_true(k_work_flush_delayable(&delayed_work, &sync));
+	zassert_equal(atomic_get(&runs), 1);
+}
+
+/* Draining waits for all the workers */
+ZTEST(work_pool, test_drain)
+{
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		start_blocker(i);
+	}
+
+	zassert_equal(k_work_submit_to_queue(&pool, &slow_work), 1);
+	release_later();
+
+	zassert_equal(k_work_queue_drain(&pool, false), 1);
+	zassert_equal(atomic_get(&runs), 1);
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		zassert_false(k_work_is_pending(&blocker_work[i]));
+	}
+}
+
+static void *work_pool_setup(void)
+{
+	k_sem_init(&release_sem, 0, K_SEM_MAX_LIMIT);
+	k_sem_init(&done_sem, 0, K_SEM_MAX_LIMIT);
+	k_timer_init(&release_timer, release_cb, NULL);
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_work_init(&blocker_work[i], blocker_handler);
+	}
+	k_work_init(&counter_work, counter_handler);
+	k_work_init(&reentry_work, reentry_handler);
+	k_work_init(&chain_work, chain_handler);
+	k_work_init(&stolen_work, stolen_handler);
+	k_work_init(&slow_work, slow_handler);
+	k_work_init_delayable(&delayed_work, counter_handler);
+
+	return NULL;
+}
+
+/* Every test runs on a freshly started pool */
+static void work_pool_before(void *fixture)
+{
+	struct k_work_queue_config cfg = {
+		.name = "wq.pool",
+		.pin_workers = IS_ENABLED(CONFIG_SCHED_CPU_MASK),
+	};
+
+	k_sem_reset(&release_sem);
+	k_sem_reset(&done_sem);
+	atomic_clear(&active);
+	atomic_clear(&max_active);
+	atomic_clear(&runs);
+
+	k_work_queue_init(&pool);
+	k_work_queue_start_pool(&pool, pool_workers, NUM_WORKERS, pool_stacks[0],
+				STACK_SIZE, POOL_PRIORITY, &cfg);
+}
+
+/* ... and is stopped afterwards */
+static void work_pool_after(void *fixture)
+{
+	(void)k_work_queue_drain(&pool, true);
+	zassert_ok(k_work_queue_stop(&pool, WAIT_TIMEOUT));
+	zassert_equal(pool.flags, 0);
+}
+
+ZTEST_SUITE(work_pool, NULL, work_pool_setup, work_pool_before, work_pool_after, NULL);
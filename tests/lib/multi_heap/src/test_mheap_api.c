@@ -443,3 +443,72 @@ ZTEST(mheap_api, test_multi_heap)
 		/* ptr = */ NULL, MHEAP_BYTES / 4);
 	zassert_not_null(ptr);
 }
+
+/**
+ * @brief Test multi heap allocations following the CPU fallback chain
+ *
+ * @details The preferred heap of the CPU is tried first, then the heaps
+ * local to it, the shared heaps, and the heaps local to other CPUs.
+ *
+ * @ingroup kernel_heap_tests
+ *
+ * @see sys_multi_heap_set_preferred(), sys_multi_heap_set_affinity(),
+ * sys_multi_heap_affinity_alloc(), sys_multi_heap_region_stats_get()
+ */
+ZTEST(mheap_api, test_multi_heap_affinity)
+{
+#ifdef CONFIG_MULTI_HEAP_AFFINITY
+	/* Preferred, local, shared then remote heaps */
+	static const int chain[N_MULTI_HEAPS] = { 3, 1, 0, 2 };
+	struct sys_multi_heap_region_stats stats;
+	char *blocks[N_MULTI_HEAPS];
+
+	sys_multi_heap_init(&multi_heap, sys_multi_heap_affinity_choice);
+	for (int i = 0; i < N_MULTI_HEAPS; i++) {
+		sys_heap_init(&mheaps[i], &heap_mem[i][0], MHEAP_BYTES);
+		sys_multi_heap_add_heap(&multi_heap, &mheaps[i], NULL);
+	}
+
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		zassert_ok(sys_multi_heap_set_preferred(&multi_heap, cpu, &mheaps[3]));
+	}
+	zassert_ok(sys_multi_heap_set_affinity(&multi_heap, &mheaps[1],
+					       BIT_MASK(CONFIG_MP_MAX_NUM_CPUS)));
+	/* No such CPU */
+	zassert_ok(sys_multi_heap_set_affinity(&multi_heap, &mheaps[2], BIT(31)));
+
+	zassert_equal(sys_multi_heap_set_preferred(&multi_heap, CONFIG_MP_MAX_NUM_CPUS,
+						   &mheaps[0]), -EINVAL);
+	zassert_equal(sys_multi_heap_set_affinity(&multi_heap, NULL, 0), -ENOENT);
+
+	for (int i = 0; i < N_MULTI_HEAPS; i++) {
+		int h = chain[i];
+
+		blocks[i] = sys_multi_heap_alloc(&multi_heap, NULL, MHEAP_BYTES / 2);
+
+		zassert_not_null(blocks[i], "allocation failed");
+		zassert_true(blocks[i] >= &heap_mem[h][0] &&
+			     blocks[i] < &heap_mem[h][MHEAP_BYTES],
+			     "allocation not in heap %d", h);
+
+		zassert_ok(sys_multi_heap_region_stats_get(&multi_heap, &mheaps[h], &stats));
+		zassert_equal(stats.allocs, 1);
+		zassert_equal(stats.fallbacks, (i == 0) ? 0 : 1);
+	}
+
+	zassert_is_null(sys_multi_heap_alloc(&multi_heap, NULL, MHEAP_BYTES / 2),
+			"all heaps should be full");
+
+	/* The preferred heap is tried first again once it has room */
+	sys_multi_heap_free(&multi_heap, blocks[0]);
+	blocks[0] = sys_multi_heap_alloc(&multi_heap, NULL, MHEAP_BYTES / 2);
+	zassert_true(blocks[0] >= &heap_mem[3][0] &&
+		     blocks[0] < &heap_mem[3][MHEAP_BYTES]);
+
+	for (int i = 0; i < N_MULTI_HEAPS; i++) {
+		sys_multi_heap_free(&multi_heap, blocks[i]);
+	}
+#else
+	ztest_test_skip();
+#endif /* CONFIG_MULTI_HEAP_AFFINITY */
+}
@@ -27,10 +27,12 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_TCP_LOG_LEVEL);
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/dummy.h>
 #include <zephyr/net/net_pkt.h>
+#include <zephyr/net/socket.h>
 
 #include "ipv4.h"
 #include "ipv6.h"
 #include "tcp.h"
+#include "tcp_internal.h"
 #include "tcp_private.h"
 #include "net_stats.h"
 
@@ -116,6 +118,9 @@ static enum test_case_no {
 	TEST_CLIENT_FIN_ACK_WITH_DATA = 18,
 	TEST_CLIENT_SEQ_VALIDATION = 19,
 	TEST_SERVER_ACK_VALIDATION = 20,
+	TEST_SERVER_SACK_BLOCKS = 21,
+	TEST_SERVER_SACK_RETRANSMIT = 22,
+	TEST_SERVER_TIMESTAMPS = 23,
 } test_case_no;
 
 static enum test_state t_state;
@@ -142,6 +147,9 @@ static void handle_syn_invalid_ack(sa_family_t af, struct tcphdr *th);
 static void handle_client_fin_ack_with_data_test(sa_family_t af, struct tcphdr *th);
 static void handle_client_seq_validation_test(sa_family_t af, struct tcphdr *th);
 static void handle_server_ack_validation_test(struct net_pkt *pkt);
+static void handle_server_sack_blocks_test(struct net_pkt *pkt);
+static void handle_server_sack_retransmit_test(struct net_pkt *pkt);
+static void handle_server_timestamps_test(struct net_pkt *pkt);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -239,6 +247,10 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
+/* Options added to every packet the tester sends, if set */
+static const uint8_t *tester_options;
+static size_t tester_options_len;
+
 static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 					      uint16_t src_port,
 					      uint16_t dst_port,
@@ -249,10 +261,12 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct net_pkt *pkt;
 	struct tcphdr *th;
-	uint8_t opts_len = 0;
+	const uint8_t *opts = tester_options;
+	uint8_t opts_len = tester_options_len;
 	int ret = -EINVAL;
 
 	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+		opts = tcp_options;
 		opts_len = sizeof(tcp_options);
 	}
 
@@ -288,11 +302,7 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		th->th_off = 10U;
-	} else {
-		th->th_off = 5U;
-	}
+	th->th_off = 5U + opts_len / 4U;
 
 	th->th_flags = flags;
 	th->th_win = htons(NET_IPV6_MTU);
@@ -307,9 +317,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if (opts_len) {
 		/* Add TCP Options */
-		ret = net_pkt_write(pkt, tcp_options, opts_len);
+		ret = net_pkt_write(pkt, opts, opts_len);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -494,6 +504,15 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_SERVER_ACK_VALIDATION:
 		handle_server_ack_validation_test(pkt);
 		break;
+	case TEST_SERVER_SACK_BLOCKS:
+		handle_server_sack_blocks_test(pkt);
+		break;
+	case TEST_SERVER_SACK_RETRANSMIT:
+		handle_server_sack_retransmit_test(pkt);
+		break;
+	case TEST_SERVER_TIMESTAMPS:
+		handle_server_timestamps_test(pkt);
+		break;
 	default:
 		zassert_true(false, "Undefined test case");
 	}
@@ -3002,4 +3021,556 @@ ZTEST(net_tcp, test_server_ack_validation)
 	net_context_put(accepted_ctx);
 }
 
+static size_t read_data_len(struct net_pkt *pkt, struct tcphdr *th)
+{
+	return net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt) -
+	       net_pkt_ip_opts_len(pkt) - th->th_off * 4U;
+}
+
+/* Returns the option of the given kind in the packet, read into options,
+ * or NULL if there is none.
+ */
+static const uint8_t *find_tcp_option(struct net_pkt *pkt, struct tcphdr *th,
+				      uint8_t kind, uint8_t *options)
+{
+	size_t len = (th->th_off - 5U) * 4U;
+	const uint8_t *found = NULL;
+	int ret;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	ret = net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) +
+			   net_pkt_ip_opts_len(pkt) + sizeof(struct tcphdr));
+	if (ret == 0) {
+		ret = net_pkt_read(pkt, options, len);
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	if (ret < 0) {
+		return NULL;
+	}
+
+	for (size_t i = 0; i < len && options[i] != NET_TCP_END_OPT; ) {
+		if (options[i] == NET_TCP_NOP_OPT) {
+			i++;
+			continue;
+		}
+
+		if (options[i] == kind) {
+			found = &options[i];
+			break;
+		}
+
+		i += options[i + 1];
+	}
+
+	return found;
+}
+
+/* Returns the number of SACK blocks in the options of the packet */
+static int read_sack_blocks(struct net_pkt *pkt, struct tcphdr *th,
+			    struct tcp_sack_block *blocks)
+{
+	uint8_t options[40];
+	const uint8_t *sack;
+	int num = 0;
+
+	sack = find_tcp_option(pkt, th, NET_TCP_SACK_OPT, options);
+	if (sack == NULL) {
+		return 0;
+	}
+
+	for (int i = NET_TCP_SACK_SIZE; i < sack[1] && num < TCP_SACK_MAX_BLOCKS;
+	     i += NET_TCP_SACK_BLOCK_SIZE) {
+		blocks[num].left = ntohl(UNALIGNED_GET((uint32_t *)&sack[i]));
+		blocks[num].right = ntohl(UNALIGNED_GET((uint32_t *)&sack[i + 4]));
+		num++;
+	}
+
+	return num;
+}
+
+static const uint8_t sack_perm_options[] = {
+	NET_TCP_NOP_OPT, NET_TCP_NOP_OPT,
+	NET_TCP_SACK_PERM_OPT, NET_TCP_SACK_PERM_SIZE,
+};
+
+static uint32_t sack_ack;
+static struct tcp_sack_block sack_blocks[TCP_SACK_MAX_BLOCKS];
+static int sack_num;
+
+static void handle_server_sack_blocks_test(struct net_pkt *pkt)
+{
+	struct tcphdr th;
+	int ret;
+
+	ret = read_tcp_header(pkt, &th);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	/* Only acknowledgments of the received data are expected */
+	test_verify_flags(&th, ACK);
+
+	sack_ack = ntohl(th.th_ack);
+	sack_num = read_sack_blocks(pkt, &th, sack_blocks);
+
+	test_sem_give();
+
+	return;
+
+fail:
+	zassert_true(false, "%s failed", __func__);
+	net_pkt_unref(pkt);
+}
+
+/* Test case scenario
+ *   Connect with SACK permitted,
+ *   send data leaving a hole of 10 bytes,
+ *   expect a duplicate ACK selectively acknowledging the data,
+ *   fill the hole,
+ *   expect an ACK of all the data, without SACK block.
+ */
+ZTEST(net_tcp, test_server_sack_blocks)
+{
+	const uint8_t *data = lorem_ipsum;
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	struct tcp *conn;
+	uint32_t base;
+	int ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_SACK);
+
+	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT == 0) {
+		ztest_test_skip();
+	}
+
+	k_sem_reset(&test_sem);
+
+	tester_options = sack_perm_options;
+	tester_options_len = sizeof(sack_perm_options);
+
+	ctx = create_server_socket(0, 0);
+
+	tester_options = NULL;
+	tester_options_len = 0;
+
+#if defined(CONFIG_NET_TCP_SACK)
+	conn = accepted_ctx->tcp;
+	zassert_true(conn->sack_ok, "SACK not negotiated");
+#else
+	ARG_UNUSED(conn);
+#endif
+
+	test_case_no = TEST_SERVER_SACK_BLOCKS;
+	base = seq;
+
+	seq = base + 10;
+	pkt = prepare_data_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT),
+				  data + 10, 10);
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	test_sem_take(K_MSEC(1000), __LINE__);
+
+	zassert_equal(sack_ack, base, "Expected ACK %u but got %u", base, sack_ack);
+	zassert_equal(sack_num, 1, "Expected 1 SACK block but got %d", sack_num);
+	zassert_equal(sack_blocks[0].left, base + 10, "Wrong SACK block left edge");
+	zassert_equal(sack_blocks[0].right, base + 20, "Wrong SACK block right edge");
+
+	seq = base;
+	pkt = prepare_data_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT),
+				  data, 10);
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	test_sem_take(K_MSEC(1000), __LINE__);
+
+	zassert_equal(sack_ack, base + 20, "Expected ACK %u but got %u", base + 20,
+		      sack_ack);
+	zassert_equal(sack_num, 0, "Expected no SACK block but got %d", sack_num);
+
+	/* Just send a RST packet to abort the underlying connection, so that
+	 * the testcase does not need to implement full TCP closing handshake.
+	 */
+	seq = base + 20;
+	pkt = prepare_rst_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT));
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
+#define SACK_MSS 100
+
+static const uint8_t sack_mss_options[] = {
+	NET_TCP_MSS_OPT, NET_TCP_MSS_SIZE, 0, SACK_MSS,
+	NET_TCP_NOP_OPT, NET_TCP_NOP_OPT,
+	NET_TCP_SACK_PERM_OPT, NET_TCP_SACK_PERM_SIZE,
+};
+
+static uint8_t sack_options[2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_SIZE +
+			    TCP_SACK_MAX_BLOCKS * NET_TCP_SACK_BLOCK_SIZE];
+static uint32_t sack_sent[8];
+static int sack_segments;
+
+/* Acknowledge the data sent by the server up to rel_ack, and selectively
+ * the given blocks, all relative to the first byte sent.
+ */
+static void send_sack_ack(sa_family_t af, uint32_t rel_ack,
+			  const struct tcp_sack_block *rel_blocks, int num)
+{
+	struct net_pkt *reply;
+	int ret;
+
+	sack_options[0] = NET_TCP_NOP_OPT;
+	sack_options[1] = NET_TCP_NOP_OPT;
+	sack_options[2] = NET_TCP_SACK_OPT;
+	sack_options[3] = NET_TCP_SACK_SIZE + num * NET_TCP_SACK_BLOCK_SIZE;
+
+	for (int i = 0; i < num; i++) {
+		uint8_t *block = &sack_options[4 + i * NET_TCP_SACK_BLOCK_SIZE];
+
+		UNALIGNED_PUT(htonl(svr_seq_base + rel_blocks[i].left), (uint32_t *)block);
+		UNALIGNED_PUT(htonl(svr_seq_base + rel_blocks[i].right), (uint32_t *)(block + 4));
+	}
+
+	if (num > 0) {
+		tester_options = sack_options;
+		tester_options_len = 2 * NET_TCP_NOP_SIZE + sack_options[3];
+	}
+
+	ack = svr_seq_base + rel_ack;
+	reply = prepare_ack_packet(af, htons(MY_PORT), htons(PEER_PORT));
+
+	tester_options = NULL;
+	tester_options_len = 0;
+
+	zassert_not_null(reply, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, reply);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+}
+
+/* The segments at 100 and 300 are lost the first time they are sent */
+static void handle_server_sack_retransmit_test(struct net_pkt *pkt)
+{
+	static const struct tcp_sack_block first[] = { { 200, 300 } };
+	static const struct tcp_sack_block both[] = { { 200, 300 }, { 400, 500 } };
+	static const struct tcp_sack_block last[] = { { 400, 500 } };
+	sa_family_t af = net_pkt_family(pkt);
+	struct tcphdr th;
+	uint32_t rel_seq;
+	bool resent = false;
+	int ret;
+
+	ret = read_tcp_header(pkt, &th);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	if (read_data_len(pkt, &th) == 0) {
+		return;
+	}
+
+	rel_seq = ntohl(th.th_seq) - svr_seq_base;
+
+	zassert_true(sack_segments < ARRAY_SIZE(sack_sent), "Too many data segments");
+
+	for (int i = 0; i < sack_segments; i++) {
+		resent = resent || (sack_sent[i] == rel_seq);
+	}
+
+	sack_sent[sack_segments++] = rel_seq;
+
+	if (resent) {
+		zassert_true(rel_seq == 100 || rel_seq == 300,
+			     "Selectively acknowledged data at %u resent", rel_seq);
+	}
+
+	switch (rel_seq) {
+	case 0:
+		send_sack_ack(af, 100, NULL, 0);
+		break;
+	case 100:
+		if (resent) {
+			send_sack_ack(af, 300, last, ARRAY_SIZE(last));
+		}
+		break;
+	case 200:
+		send_sack_ack(af, 100, first, ARRAY_SIZE(first));
+		break;
+	case 300:
+		if (resent) {
+			send_sack_ack(af, 500, NULL, 0);
+			test_sem_give();
+		}
+		break;
+	case 400:
+		/* Third and fourth duplicate ACK triggers the fast retransmit */
+		send_sack_ack(af, 100, both, ARRAY_SIZE(both));
+		send_sack_ack(af, 100, both, ARRAY_SIZE(both));
+		break;
+	default:
+		zassert_true(false, "Unexpected data at %u", rel_seq);
+	}
+
+	return;
+
+fail:
+	zassert_true(false, "%s failed", __func__);
+	net_pkt_unref(pkt);
+}
+
+/* Test case scenario
+ *   Connect with SACK permitted,
+ *   expect five data segments, of which the second and fourth are lost,
+ *   selectively acknowledge the others with duplicate ACKs,
+ *   expect only the lost segments to be retransmitted.
+ */
+ZTEST(net_tcp, test_server_sack_retransmit)
+{
+	struct net_context *ctx;
+	struct net_pkt *rst;
+	struct tcp *conn;
+	int ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_SACK);
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_FAST_RETRANSMIT);
+
+	k_sem_reset(&test_sem);
+
+	tester_options = sack_mss_options;
+	tester_options_len = sizeof(sack_mss_options);
+
+	ctx = create_server_socket(0, 0);
+	svr_seq_base = ack;
+
+	tester_options = NULL;
+	tester_options_len = 0;
+
+	conn = accepted_ctx->tcp;
+#if defined(CONFIG_NET_TCP_SACK)
+	zassert_true(conn->sack_ok, "SACK not negotiated");
+#endif
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+	/* Send all the segments at once */
+	k_mutex_lock(&conn->lock, K_FOREVER);
+	conn->ca.cwnd = 5 * SACK_MSS;
+	k_mutex_unlock(&conn->lock);
+#endif
+
+	sack_segments = 0;
+	test_case_no = TEST_SERVER_SACK_RETRANSMIT;
+
+	ret = net_context_send(conn->context, lorem_ipsum, 5 * SACK_MSS, NULL,
+			       K_NO_WAIT, NULL);
+	zassert_true(ret >= 0, "Failed to send data to peer %d", ret);
+
+	/* Peer will release the semaphore once all the data is acknowledged */
+	test_sem_take(K_MSEC(1000), __LINE__);
+
+	/* Make sure that nothing else is resent on retransmission timeout */
+	k_msleep(CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT * 3);
+
+	zassert_equal(sack_segments, 7, "Expected 7 data segments but got %d",
+		      sack_segments);
+
+	rst = tester_prepare_tcp_pkt(AF_INET6, htons(MY_PORT), htons(PEER_PORT), RST, NULL, 0);
+	zassert_not_null(rst, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, rst);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
+static uint8_t ts_options[2 * NET_TCP_NOP_SIZE + NET_TCP_TIMESTAMP_SIZE];
+static uint32_t ts_ack;
+static uint32_t ts_val;
+static uint32_t ts_ecr;
+static int ts_data_len;
+
+/* Send the timestamp option in the following segments of the tester */
+static void set_ts_options(uint32_t tsval, uint32_t tsecr)
+{
+	ts_options[0] = NET_TCP_NOP_OPT;
+	ts_options[1] = NET_TCP_NOP_OPT;
+	ts_options[2] = NET_TCP_TIMESTAMP_OPT;
+	ts_options[3] = NET_TCP_TIMESTAMP_SIZE;
+	UNALIGNED_PUT(htonl(tsval), (uint32_t *)&ts_options[4]);
+	UNALIGNED_PUT(htonl(tsecr), (uint32_t *)&ts_options[8]);
+
+	tester_options = ts_options;
+	tester_options_len = sizeof(ts_options);
+}
+
+static void handle_server_timestamps_test(struct net_pkt *pkt)
+{
+	uint8_t options[40];
+	const uint8_t *ts;
+	struct tcphdr th;
+	int ret;
+
+	ret = read_tcp_header(pkt, &th);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	ts_ack = ntohl(th.th_ack);
+	ts_data_len = read_data_len(pkt, &th);
+
+	ts = find_tcp_option(pkt, &th, NET_TCP_TIMESTAMP_OPT, options);
+	zassert_not_null(ts, "No timestamp option");
+
+	ts_val = ntohl(UNALIGNED_GET((uint32_t *)&ts[2]));
+	ts_ecr = ntohl(UNALIGNED_GET((uint32_t *)&ts[6]));
+
+	test_sem_give();
+
+	return;
+
+fail:
+	zassert_true(false, "%s failed", __func__);
+	net_pkt_unref(pkt);
+}
+
+#define TS_RTT_MS 50
+
+/* Test case scenario
+ *   Connect with timestamps,
+ *   expect data echoing our timestamp,
+ *   acknowledge it after TS_RTT_MS echoing the server timestamp,
+ *   expect the round-trip time to be measured,
+ *   send data with an old timestamp, expect it to be dropped,
+ *   send the same data with a new timestamp, expect it to be acknowledged.
+ */
+ZTEST(net_tcp, test_server_timestamps)
+{
+	struct tcp_info info;
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	size_t info_len = sizeof(info);
+	uint32_t base;
+	int ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_TIMESTAMPS);
+
+	k_sem_reset(&test_sem);
+
+	set_ts_options(100, 0);
+
+	ctx = create_server_socket(0, 0);
+	svr_seq_base = ack;
+
+	tester_options = NULL;
+	tester_options_len = 0;
+
+#if defined(CONFIG_NET_TCP_TIMESTAMPS)
+	zassert_true(accepted_ctx->tcp->ts_ok, "Timestamps not negotiated");
+	zassert_equal(accepted_ctx->tcp->ts_recent, 100, "Wrong recent timestamp");
+#endif
+
+	test_case_no = TEST_SERVER_TIMESTAMPS;
+	base = seq;
+
+	ret = net_context_send(accepted_ctx, lorem_ipsum, 10, NULL, K_NO_WAIT, NULL);
+	zassert_true(ret >= 0, "Failed to send data to peer %d", ret);
+
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	zassert_equal(ts_data_len, 10, "Expected 10 bytes but got %d", ts_data_len);
+	zassert_equal(ts_ecr, 100, "Expected echo of 100 but got %u", ts_ecr);
+
+	k_msleep(TS_RTT_MS);
+
+	set_ts_options(101, ts_val);
+	ack = svr_seq_base + 10;
+	pkt = prepare_ack_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT));
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	ret = net_tcp_get_option(accepted_ctx, TCP_OPT_INFO, &info, &info_len);
+	zassert_equal(ret, 0, "Cannot get TCP info (%d)", ret);
+	zassert_equal(info_len, sizeof(info), "Wrong TCP info length");
+	zassert_true(info.tcpi_options & TCPI_OPT_TIMESTAMPS, "Timestamps not reported");
+	zassert_true(info.tcpi_rtt >= TS_RTT_MS * USEC_PER_MSEC &&
+		     info.tcpi_rtt < (TS_RTT_MS + 50) * USEC_PER_MSEC,
+		     "Unexpected rtt %u us", info.tcpi_rtt);
+	/* The first sample sets the variation to half of it */
+	zassert_equal(info.tcpi_rttvar, info.tcpi_rtt / 2, "Unexpected rttvar %u us",
+		      info.tcpi_rttvar);
+	zassert_equal(info.tcpi_rto, 3 * info.tcpi_rtt, "Unexpected rto %u us",
+		      info.tcpi_rto);
+
+	/* An older timestamp than the last one is dropped, and acknowledged */
+	set_ts_options(50, ts_val);
+	pkt = prepare_data_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT),
+				  lorem_ipsum, 5);
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	zassert_equal(ts_ack, base, "Expected ACK %u but got %u", base, ts_ack);
+	zassert_equal(ts_ecr, 101, "Expected echo of 101 but got %u", ts_ecr);
+
+	set_ts_options(102, ts_val);
+	seq = base;
+	pkt = prepare_data_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT),
+				  lorem_ipsum, 5);
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	test_sem_take(K_MSEC(1000), __LINE__);
+
+	zassert_equal(ts_ack, base + 5, "Expected ACK %u but got %u", base + 5, ts_ack);
+	zassert_equal(ts_ecr, 102, "Expected echo of 102 but got %u", ts_ecr);
+
+	tester_options = NULL;
+	tester_options_len = 0;
+
+	/* Just send a RST packet to abort the underlying connection, so that
+	 * the testcase does not need to implement full TCP closing handshake.
+	 */
+	seq = base + 5;
+	pkt = prepare_rst_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT));
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);